@@ -26,6 +26,7 @@
 //------------------------------------------------------------------------------
 
 #import "MSALAccountEnumerationParameters+Private.h"
+#import "MSALParameters+Internal.h"
 
 @interface MSALAccountEnumerationParameters()
 
@@ -90,6 +91,19 @@
     return self;
 }
 
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    MSALAccountEnumerationParameters *parameters = [super copyWithZone:zone];
+    parameters.identifier = self.identifier;
+    parameters.tenantProfileIdentifier = self.tenantProfileIdentifier;
+    parameters.username = self.username;
+    parameters.returnOnlySignedInAccounts = self.returnOnlySignedInAccounts;
+    parameters.ignoreSignedInStatus = self.ignoreSignedInStatus;
+    return parameters;
+}
+
 #pragma mark - Description
 
 - (NSString *)description
@@ -33,6 +33,7 @@
 #import "MSIDAccessToken.h"
 #import "MSIDDefaultTokenCacheAccessor.h"
 #import "MSIDAssymetricKeyPair.h"
+#import "MSALDevicePopManager.h"
 
 static NSString *keyDelimiter = @" ";
 
@@ -80,7 +81,7 @@ static NSString *keyDelimiter = @" ";
 - (NSDictionary *)getSchemeParameters:(MSIDDevicePopManager *)popManager
 {
     NSMutableDictionary *schemeParams = [NSMutableDictionary new];
-    NSString *requestConf = popManager.keyPair.jsonWebKey;
+    NSString *requestConf = [self jsonWebKeyFromPopManager:popManager];
     if (requestConf)
     {
         [schemeParams setObject:MSALParameterStringForAuthScheme(self.scheme) forKey:MSID_OAUTH2_TOKEN_TYPE];
@@ -104,12 +105,27 @@ static NSString *keyDelimiter = @" ";
 
 - (nullable NSString *)getClientAccessToken:(MSIDAccessToken *)accessToken popManager:(nullable MSIDDevicePopManager *)popManager error:(NSError **)error
 {
+    NSString *httpMethod = MSALParameterStringForHttpMethod(self.httpMethod);
+    NSString *requestUrl = self.requestUrl.absoluteString;
     NSString *signedAccessToken = [popManager createSignedAccessToken:accessToken.accessToken
-                                                           httpMethod:MSALParameterStringForHttpMethod(self.httpMethod)
-                                                           requestUrl:self.requestUrl.absoluteString
+                                                           httpMethod:httpMethod
+                                                           requestUrl:requestUrl
                                                                 nonce:self.nonce
                                                                 error:error];
     
+    if (!signedAccessToken && [popManager isKindOfClass:MSALDevicePopManager.class])
+    {
+        // Cached key might have been removed from the keychain, retry once with a fresh read.
+        MSID_LOG_WITH_CTX(MSIDLogLevelWarning, nil, @"Failed to sign access token with cached key, retrying with key from keychain.");
+        
+        [(MSALDevicePopManager *)popManager invalidateKeyMaterial];
+        signedAccessToken = [popManager createSignedAccessToken:accessToken.accessToken
+                                                     httpMethod:httpMethod
+                                                     requestUrl:requestUrl
+                                                          nonce:self.nonce
+                                                          error:error];
+    }
+    
     if (!signedAccessToken)
     {
         MSID_LOG_WITH_CTX(MSIDLogLevelError, nil, @"Failed to sign access token.");
@@ -125,6 +141,16 @@ static NSString *keyDelimiter = @" ";
     return signedAccessToken;
 }
 
+- (nullable NSString *)jsonWebKeyFromPopManager:(MSIDDevicePopManager *)popManager
+{
+    if ([popManager isKindOfClass:MSALDevicePopManager.class])
+    {
+        return [(MSALDevicePopManager *)popManager keyMaterial].jsonWebKey;
+    }
+    
+    return popManager.keyPair.jsonWebKey;
+}
+
 - (NSString *)getAuthorizationHeader:(NSString *)accessToken
 {
     return [NSString stringWithFormat:@"%@%@%@", self.authenticationScheme, keyDelimiter, accessToken];
@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import "MSIDDevicePopManager.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class MSIDAssymetricKeyPair;
+
+/// Immutable snapshot of the public/private key material used to sign PoP tokens.
+@interface MSALPopKeyMaterial : NSObject
+
+@property (nonatomic, readonly) MSIDAssymetricKeyPair *keyPair;
+@property (nonatomic, readonly) NSString *jsonWebKey;
+@property (nonatomic, readonly) NSString *thumbprint;
+@property (nonatomic, readonly) SecKeyRef privateKeyRef;
+@property (nonatomic, readonly) NSDate *lastValidatedOn;
+
+@end
+
+/// Pop manager that reads the key pair from the keychain once and keeps serving it
+/// until the key is rotated, instead of going to the keychain on every sign call.
+@interface MSALDevicePopManager : MSIDDevicePopManager
+
+/// How often the cached key is compared against the keychain to pick up a rotation done outside of this instance. Default is 300 seconds.
+@property (atomic) NSTimeInterval keyValidationInterval;
+
+/// Returns the cached key material, loading it from the keychain on first access or after the key has been invalidated.
+- (nullable MSALPopKeyMaterial *)keyMaterial;
+
+/// Drops the cached key material, the next access reads it again from the keychain.
+- (void)invalidateKeyMaterial;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,137 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import "MSALDevicePopManager.h"
+#import "MSIDAssymetricKeyPair.h"
+
+static const NSTimeInterval MSALDefaultPopKeyValidationInterval = 300;
+
+@interface MSALPopKeyMaterial()
+
+- (instancetype)initWithKeyPair:(MSIDAssymetricKeyPair *)keyPair;
+- (void)markValidated;
+
+@end
+
+@implementation MSALPopKeyMaterial
+
+- (instancetype)initWithKeyPair:(MSIDAssymetricKeyPair *)keyPair
+{
+    NSString *jsonWebKey = keyPair.jsonWebKey;
+    NSString *thumbprint = keyPair.kid;
+    
+    if (!jsonWebKey || !thumbprint || !keyPair.privateKeyRef) return nil;
+    
+    self = [super init];
+    if (self)
+    {
+        _keyPair = keyPair;
+        _jsonWebKey = jsonWebKey;
+        _thumbprint = thumbprint;
+        _lastValidatedOn = [NSDate date];
+    }
+    
+    return self;
+}
+
+- (SecKeyRef)privateKeyRef
+{
+    return self.keyPair.privateKeyRef;
+}
+
+- (void)markValidated
+{
+    _lastValidatedOn = [NSDate date];
+}
+
+@end
+
+@interface MSALDevicePopManager()
+
+@property (nonatomic, nullable) MSALPopKeyMaterial *cachedKeyMaterial;
+
+@end
+
+@implementation MSALDevicePopManager
+
+- (instancetype)initWithCacheConfig:(MSIDCacheConfig *)cacheConfig
+                  keyPairAttributes:(MSIDAssymetricKeyLookupAttributes *)keyPairAttributes
+{
+    self = [super initWithCacheConfig:cacheConfig keyPairAttributes:keyPairAttributes];
+    if (self)
+    {
+        _keyValidationInterval = MSALDefaultPopKeyValidationInterval;
+    }
+    
+    return self;
+}
+
+- (MSIDAssymetricKeyPair *)keyPair
+{
+    MSALPopKeyMaterial *keyMaterial = [self keyMaterial];
+    return keyMaterial ? keyMaterial.keyPair : [super keyPair];
+}
+
+- (MSALPopKeyMaterial *)keyMaterial
+{
+    @synchronized (self)
+    {
+        MSALPopKeyMaterial *keyMaterial = self.cachedKeyMaterial;
+        
+        if (keyMaterial && -[keyMaterial.lastValidatedOn timeIntervalSinceNow] < self.keyValidationInterval)
+        {
+            return keyMaterial;
+        }
+        
+        // Either nothing is cached yet or it is time to check the keychain for a rotated key.
+        MSIDAssymetricKeyPair *keyPair = [super keyPair];
+        
+        if (keyMaterial && keyPair && [keyPair.kid isEqualToString:keyMaterial.thumbprint])
+        {
+            [keyMaterial markValidated];
+            return keyMaterial;
+        }
+        
+        if (keyMaterial)
+        {
+            MSID_LOG_WITH_CTX(MSIDLogLevelInfo, nil, @"PoP key was rotated, refreshing cached key material.");
+        }
+        
+        self.cachedKeyMaterial = keyPair ? [[MSALPopKeyMaterial alloc] initWithKeyPair:keyPair] : nil;
+        return self.cachedKeyMaterial;
+    }
+}
+
+- (void)invalidateKeyMaterial
+{
+    @synchronized (self)
+    {
+        self.cachedKeyMaterial = nil;
+    }
+}
+
+@end
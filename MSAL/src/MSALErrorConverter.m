@@ -30,140 +30,204 @@
 #import "MSALError.h"
 #import "MSALOauth2Provider.h"
 
-static NSDictionary *s_errorDomainMapping;
-static NSDictionary *s_errorCodeMapping;
-static NSDictionary *s_userInfoKeyMapping;
-static NSSet *s_recoverableErrorCode;
+typedef struct
+{
+    NSInteger msidCode;
+    NSInteger msalCode;
+} MSALErrorCodeMapping;
 
-@implementation MSALErrorConverter
+typedef struct
+{
+    __unsafe_unretained NSString *msidKey;
+    __unsafe_unretained NSString *msalKey;
+} MSALUserInfoKeyMapping;
 
-+ (void)initialize
+// MSIDErrorDomain/MSIDOAuthErrorDomain/MSIDHttpErrorCodeDomain code -> MSALErrorDomain code.
+// Sorted by msidCode once in +initialize, lookups are a binary search without boxing.
+static MSALErrorCodeMapping s_errorCodeMapping[] =
+{
+    // General
+    { MSIDErrorInternal, MSALErrorInternal },
+    { MSIDErrorInvalidInternalParameter, MSALErrorInternal },
+    { MSIDErrorInvalidDeveloperParameter, MSALInternalErrorInvalidParameter },
+    { MSIDErrorUnsupportedFunctionality, MSALErrorInternal },
+    { MSIDErrorMissingAccountParameter, MSALInternalErrorAccountRequired },
+    { MSIDErrorInteractionRequired, MSALErrorInteractionRequired },
+    { MSIDErrorServerNonHttpsRedirect, MSALInternalErrorNonHttpsRedirect },
+    { MSIDErrorMismatchedAccount, MSALInternalErrorMismatchedUser },
+    { MSIDErrorRedirectSchemeNotRegistered, MSALInternalErrorRedirectSchemeNotRegistered },
+    { MSIDErrorInvalidRedirectURI, MSALInternalErrorInvalidRedirectURI },
+    // Cache
+    { MSIDErrorCacheMultipleUsers, MSALInternalErrorAmbiguousAccount },
+    { MSIDErrorCacheBadFormat, MSALErrorInternal },
+    // Authority Validation
+    { MSIDErrorAuthorityValidation, MSALInternalErrorFailedAuthorityValidation },
+    // Interactive flow
+    { MSIDErrorAuthorizationFailed, MSALInternalErrorAuthorizationFailed },
+    { MSIDErrorUserCancel, MSALErrorUserCanceled },
+    { MSIDErrorSessionCanceledProgrammatically, MSALErrorUserCanceled },
+    { MSIDErrorInteractiveSessionStartFailure, MSALErrorInternal },
+    { MSIDErrorInteractiveSessionAlreadyRunning, MSALInternalErrorInteractiveSessionAlreadyRunning },
+    { MSIDErrorNoMainViewController, MSALInternalErrorNoViewController },
+    { MSIDErrorAttemptToOpenURLFromExtension, MSALInternalErrorAttemptToOpenURLFromExtension },
+    { MSIDErrorUINotSupportedInExtension, MSALInternalErrorUINotSupportedInExtension },
+    { MSIDErrorInsufficientDeviceStrength, MSALErrorInsufficientDeviceStrength },
+    { MSIDErrorMDMEnrollmentCompletedNeedsRetry, MSALErrorMDMEnrollmentCompletedNeedsRetry },
+    { MSIDErrorInvalidASWebAuthenticationURL, MSALInternalErrorInvalidASWebAuthenticationURL },
+    // Broker errors
+    { MSIDErrorBrokerResponseNotReceived, MSALInternalErrorBrokerResponseNotReceived },
+    { MSIDErrorBrokerNoResumeStateFound, MSALInternalErrorBrokerNoResumeStateFound },
+    { MSIDErrorBrokerBadResumeStateFound, MSALInternalErrorBrokerBadResumeStateFound },
+    { MSIDErrorBrokerMismatchedResumeState, MSALInternalErrorBrokerMismatchedResumeState },
+    { MSIDErrorBrokerResponseHashMissing, MSALInternalErrorBrokerResponseHashMissing },
+    { MSIDErrorBrokerCorruptedResponse, MSALInternalErrorBrokerCorruptedResponse },
+    { MSIDErrorBrokerResponseDecryptionFailed, MSALInternalErrorBrokerResponseDecryptionFailed },
+    { MSIDErrorBrokerResponseHashMismatch, MSALInternalErrorBrokerResponseHashMismatch },
+    { MSIDErrorBrokerKeyFailedToCreate, MSALInternalErrorBrokerKeyFailedToCreate },
+    { MSIDErrorBrokerKeyNotFound, MSALInternalErrorBrokerKeyNotFound },
+    { MSIDErrorWorkplaceJoinRequired, MSALErrorWorkplaceJoinRequired },
+    { MSIDErrorBrokerUnknown, MSALInternalErrorBrokerUnknown },
+    { MSIDErrorBrokerApplicationTokenReadFailed, MSALInternalErrorBrokerApplicationTokenReadFailed },
+    { MSIDErrorBrokerApplicationTokenWriteFailed, MSALInternalErrorBrokerApplicationTokenWriteFailed },
+    { MSIDErrorBrokerNotAvailable, MSALInternalBrokerNotAvailable },
+    { MSIDErrorJITLinkServerConfirmationError, MSALInternalErrorJITLinkServerConfirmationError },
+    { MSIDErrorJITLinkAcquireTokenError, MSALInternalErrorJITLinkAcquireTokenError },
+    { MSIDErrorJITLinkTokenAcquiredWrongTenant, MSALInternalErrorJITLinkTokenAcquiredWrongTenant },
+    { MSIDErrorJITLinkError, MSALInternalErrorJITLinkError },
+    { MSIDErrorJITComplianceCheckResultNotCompliant, MSALInternalErrorJITComplianceCheckResultNotCompliant },
+    { MSIDErrorJITComplianceCheckResultTimeout, MSALInternalErrorJITComplianceCheckResultTimeout },
+    { MSIDErrorJITComplianceCheckResultUnknown, MSALInternalErrorJITComplianceCheckResultUnknown },
+    { MSIDErrorJITComplianceCheckInvalidLinkPayload, MSALErrorJITComplianceCheckInvalidLinkPayload },
+    { MSIDErrorJITComplianceCheckCreateController, MSALErrorJITComplianceCheckCreateController },
+    { MSIDErrorJITLinkConfigNotFound, MSALErrorJITLinkConfigNotFound },
+    { MSIDErrorJITInvalidLinkTokenConfig, MSALErrorJITInvalidLinkTokenConfig },
+    { MSIDErrorJITWPJDeviceRegistrationFailed, MSALErrorJITWPJDeviceRegistrationFailed },
+    { MSIDErrorJITWPJAccountIdentifierNil, MSALErrorJITWPJAccountIdentifierNil },
+    { MSIDErrorJITWPJAcquireTokenError, MSALErrorJITWPJAcquireTokenError },
+    { MSIDErrorJITRetryRequired, MSALErrorJITRetryRequired },
+    { MSIDErrorJITUnknownStatusWebCP, MSALErrorJITUnknownStatusWebCP },
+    { MSIDErrorJITTroubleshootingRequired, MSALErrorJITTroubleshootingRequired },
+    { MSIDErrorJITTroubleshootingCreateController, MSALErrorJITTroubleshootingCreateController },
+    { MSIDErrorJITTroubleshootingResultUnknown, MSALErrorJITTroubleshootingResultUnknown },
+    { MSIDErrorJITTroubleshootingAcquireToken, MSALErrorJITTroubleshootingAcquireToken },
+    { MSIDErrorDeviceNotPSSORegistered, MSALErrorDeviceNotPSSORegistered },
+    { MSIDErrorPSSOKeyIdMismatch, MSALErrorPSSOKeyIdMismatch },
+    { MSIDErrorJITErrorHandlingConfigNotFound, MSALErrorJITErrorHandlingConfigNotFound },
+    { MSIDErrorPSSOBiometricPolicyMismatch, MSALErrorPSSOBiometricPolicyMismatch },
+    { MSIDErrorPSSOInvalidPasskeyExtension, MSALErrorPSSOInvalidPasskeyExtension },
+    { MSIDErrorPSSOSaveLoginConfigFailure, MSALErrorPSSOSaveLoginConfigFailure },
+    { MSIDErrorPSSOPasskeyLAError, MSALErrorPSSOPasskeyLAError },
+    { MSIDErrorPSSOBiometricsNotAvailable, MSALErrorPSSOBiometricsNotAvailable },
+    { MSIDErrorPSSOBiometricsNotEnrolled, MSALErrorPSSOBiometricsNotEnrolled },
+    // Oauth2 errors
+    { MSIDErrorServerOauth, MSALInternalErrorAuthorizationFailed },
+    { MSIDErrorServerInvalidResponse, MSALInternalErrorInvalidResponse },
+    // We don't support this error code in MSAL. This error
+    // exists specifically for ADAL.
+    { MSIDErrorServerRefreshTokenRejected, MSALErrorInternal },
+    { MSIDErrorServerInvalidRequest, MSALInternalErrorInvalidRequest },
+    { MSIDErrorServerInvalidClient, MSALInternalErrorInvalidClient },
+    { MSIDErrorServerInvalidGrant, MSALInternalErrorInvalidGrant },
+    { MSIDErrorServerInvalidScope, MSALInternalErrorInvalidScope },
+    { MSIDErrorServerUnauthorizedClient, MSALInternalErrorUnauthorizedClient },
+    { MSIDErrorServerAccessDenied, MSALErrorUserCanceled },
+    { MSIDErrorServerDeclinedScopes, MSALErrorServerDeclinedScopes },
+    { MSIDErrorServerError, MSALErrorServerError },
+    { MSIDErrorServerInvalidState, MSALInternalErrorInvalidState },
+    { MSIDErrorServerProtectionPoliciesRequired, MSALErrorServerProtectionPoliciesRequired },
+    { MSIDErrorServerUnhandledResponse, MSALInternalErrorUnhandledResponse },
+    { MSIDErrorUnexpectedHttpResponse, MSALInternalErrorUnexpectedHttpResponse },
+    { MSIDErrorServerInvalidRequestResetPasswordRequired, MSALErrorServerInvalidRequestResetPasswordRequired },
+};
+
+static const size_t s_errorCodeMappingCount = sizeof(s_errorCodeMapping) / sizeof(s_errorCodeMapping[0]);
+
+static MSALUserInfoKeyMapping s_userInfoKeyMapping[14];
+
+static const NSInteger s_recoverableErrorCodes[] =
+{
+    MSALErrorWorkplaceJoinRequired,
+    MSALErrorInteractionRequired,
+    MSALErrorServerDeclinedScopes,
+    MSALErrorServerProtectionPoliciesRequired,
+    MSALErrorUserCanceled,
+    MSALErrorServerInvalidRequestResetPasswordRequired
+};
+
+static int MSALCompareErrorCodeMapping(const void *lhs, const void *rhs)
+{
+    NSInteger lhsCode = ((const MSALErrorCodeMapping *)lhs)->msidCode;
+    NSInteger rhsCode = ((const MSALErrorCodeMapping *)rhs)->msidCode;
+    return (lhsCode > rhsCode) - (lhsCode < rhsCode);
+}
+
+static BOOL MSALMapErrorCode(NSInteger msidCode, NSInteger *msalCode)
+{
+    MSALErrorCodeMapping key = { msidCode, 0 };
+    const MSALErrorCodeMapping *entry = bsearch(&key, s_errorCodeMapping, s_errorCodeMappingCount, sizeof(MSALErrorCodeMapping), MSALCompareErrorCodeMapping);
+    
+    if (!entry) return NO;
+    
+    *msalCode = entry->msalCode;
+    return YES;
+}
+
+static NSString *MSALMapErrorDomain(NSString *domain)
+{
+    if ([domain isEqualToString:MSIDErrorDomain]
+        || [domain isEqualToString:MSIDOAuthErrorDomain]
+        || [domain isEqualToString:MSIDHttpErrorCodeDomain])
+    {
+        return MSALErrorDomain;
+    }
+    
+    if ([domain isEqualToString:MSIDKeychainErrorDomain])
+    {
+        return NSOSStatusErrorDomain;
+    }
+    
+    return nil;
+}
+
+static BOOL MSALIsRecoverableErrorCode(NSInteger code)
 {
-    s_errorDomainMapping = @{
-                             MSIDErrorDomain : MSALErrorDomain,
-                             MSIDOAuthErrorDomain : MSALErrorDomain,
-                             MSIDKeychainErrorDomain : NSOSStatusErrorDomain,
-                             MSIDHttpErrorCodeDomain : MSALErrorDomain
-                             };
+    for (size_t i = 0; i < sizeof(s_recoverableErrorCodes) / sizeof(s_recoverableErrorCodes[0]); i++)
+    {
+        if (s_recoverableErrorCodes[i] == code) return YES;
+    }
+    
+    return NO;
+}
 
-    s_errorCodeMapping = @{
-                           MSALErrorDomain:@{
-                                   // General
-                                   @(MSIDErrorInternal) : @(MSALErrorInternal),
-                                   @(MSIDErrorInvalidInternalParameter) : @(MSALErrorInternal),
-                                   @(MSIDErrorInvalidDeveloperParameter) :@(MSALInternalErrorInvalidParameter),
-                                   @(MSIDErrorUnsupportedFunctionality): @(MSALErrorInternal),
-                                   @(MSIDErrorMissingAccountParameter): @(MSALInternalErrorAccountRequired),
-                                   @(MSIDErrorInteractionRequired): @(MSALErrorInteractionRequired),
-                                   @(MSIDErrorServerNonHttpsRedirect) : @(MSALInternalErrorNonHttpsRedirect),
-                                   @(MSIDErrorMismatchedAccount): @(MSALInternalErrorMismatchedUser),
-                                   @(MSIDErrorRedirectSchemeNotRegistered): @(MSALInternalErrorRedirectSchemeNotRegistered),
-                                   @(MSIDErrorInvalidRedirectURI): @(MSALInternalErrorInvalidRedirectURI),
+@implementation MSALErrorConverter
 
-                                   // Cache
-                                   @(MSIDErrorCacheMultipleUsers) : @(MSALInternalErrorAmbiguousAccount),
-                                   @(MSIDErrorCacheBadFormat) : @(MSALErrorInternal),
-                                   // Authority Validation
-                                   @(MSIDErrorAuthorityValidation) : @(MSALInternalErrorFailedAuthorityValidation),
-                                   // Interactive flow
-                                   @(MSIDErrorAuthorizationFailed) : @(MSALInternalErrorAuthorizationFailed),
-                                   @(MSIDErrorUserCancel) : @(MSALErrorUserCanceled),
-                                   @(MSIDErrorSessionCanceledProgrammatically) : @(MSALErrorUserCanceled),
-                                   @(MSIDErrorInteractiveSessionStartFailure) : @(MSALErrorInternal),
-                                   @(MSIDErrorInteractiveSessionAlreadyRunning) : @(MSALInternalErrorInteractiveSessionAlreadyRunning),
-                                   @(MSIDErrorNoMainViewController) : @(MSALInternalErrorNoViewController),
-                                   @(MSIDErrorAttemptToOpenURLFromExtension): @(MSALInternalErrorAttemptToOpenURLFromExtension),
-                                   @(MSIDErrorUINotSupportedInExtension): @(MSALInternalErrorUINotSupportedInExtension),
-                                   @(MSIDErrorInsufficientDeviceStrength): @(MSALErrorInsufficientDeviceStrength),
-                                   @(MSIDErrorMDMEnrollmentCompletedNeedsRetry): @(MSALErrorMDMEnrollmentCompletedNeedsRetry),
-                                   @(MSIDErrorInvalidASWebAuthenticationURL): @(MSALInternalErrorInvalidASWebAuthenticationURL),
-                                   // Broker errors
-                                   @(MSIDErrorBrokerResponseNotReceived): @(MSALInternalErrorBrokerResponseNotReceived),
-                                   @(MSIDErrorBrokerNoResumeStateFound): @(MSALInternalErrorBrokerNoResumeStateFound),
-                                   @(MSIDErrorBrokerBadResumeStateFound): @(MSALInternalErrorBrokerBadResumeStateFound),
-                                   @(MSIDErrorBrokerMismatchedResumeState): @(MSALInternalErrorBrokerMismatchedResumeState),
-                                   @(MSIDErrorBrokerResponseHashMissing): @(MSALInternalErrorBrokerResponseHashMissing),
-                                   @(MSIDErrorBrokerCorruptedResponse): @(MSALInternalErrorBrokerCorruptedResponse),
-                                   @(MSIDErrorBrokerResponseDecryptionFailed): @(MSALInternalErrorBrokerResponseDecryptionFailed),
-                                   @(MSIDErrorBrokerResponseHashMismatch): @(MSALInternalErrorBrokerResponseHashMismatch),
-                                   @(MSIDErrorBrokerKeyFailedToCreate): @(MSALInternalErrorBrokerKeyFailedToCreate),
-                                   @(MSIDErrorBrokerKeyNotFound): @(MSALInternalErrorBrokerKeyNotFound),
-                                   @(MSIDErrorWorkplaceJoinRequired): @(MSALErrorWorkplaceJoinRequired),
-                                   @(MSIDErrorBrokerUnknown): @(MSALInternalErrorBrokerUnknown),
-                                   @(MSIDErrorBrokerApplicationTokenReadFailed): @(MSALInternalErrorBrokerApplicationTokenReadFailed),
-                                   @(MSIDErrorBrokerApplicationTokenWriteFailed): @(MSALInternalErrorBrokerApplicationTokenWriteFailed),
-                                   @(MSIDErrorBrokerNotAvailable) : @(MSALInternalBrokerNotAvailable),
-                                   @(MSIDErrorJITLinkServerConfirmationError) : @(MSALInternalErrorJITLinkServerConfirmationError),
-                                   @(MSIDErrorJITLinkAcquireTokenError) : @(MSALInternalErrorJITLinkAcquireTokenError),
-                                   @(MSIDErrorJITLinkTokenAcquiredWrongTenant) : @(MSALInternalErrorJITLinkTokenAcquiredWrongTenant),
-                                   @(MSIDErrorJITLinkError) : @(MSALInternalErrorJITLinkError),
-                                   @(MSIDErrorJITComplianceCheckResultNotCompliant) : @(MSALInternalErrorJITComplianceCheckResultNotCompliant),
-                                   @(MSIDErrorJITComplianceCheckResultTimeout) : @(MSALInternalErrorJITComplianceCheckResultTimeout),
-                                   @(MSIDErrorJITComplianceCheckResultUnknown) : @(MSALInternalErrorJITComplianceCheckResultUnknown),
-                                   @(MSIDErrorJITComplianceCheckInvalidLinkPayload) : @(MSALErrorJITComplianceCheckInvalidLinkPayload),
-                                   @(MSIDErrorJITComplianceCheckCreateController) : @(MSALErrorJITComplianceCheckCreateController),
-                                   @(MSIDErrorJITLinkConfigNotFound) : @(MSALErrorJITLinkConfigNotFound),
-                                   @(MSIDErrorJITInvalidLinkTokenConfig) : @(MSALErrorJITInvalidLinkTokenConfig),
-                                   @(MSIDErrorJITWPJDeviceRegistrationFailed) : @(MSALErrorJITWPJDeviceRegistrationFailed),
-                                   @(MSIDErrorJITWPJAccountIdentifierNil) : @(MSALErrorJITWPJAccountIdentifierNil),
-                                   @(MSIDErrorJITWPJAcquireTokenError) : @(MSALErrorJITWPJAcquireTokenError),
-                                   @(MSIDErrorJITRetryRequired) : @(MSALErrorJITRetryRequired),
-                                   @(MSIDErrorJITUnknownStatusWebCP) : @(MSALErrorJITUnknownStatusWebCP),
-                                   @(MSIDErrorJITTroubleshootingRequired) : @(MSALErrorJITTroubleshootingRequired),
-                                   @(MSIDErrorJITTroubleshootingCreateController) : @(MSALErrorJITTroubleshootingCreateController),
-                                   @(MSIDErrorJITTroubleshootingResultUnknown) : @(MSALErrorJITTroubleshootingResultUnknown),
-                                   @(MSIDErrorJITTroubleshootingAcquireToken) : @(MSALErrorJITTroubleshootingAcquireToken),
-                                   @(MSIDErrorDeviceNotPSSORegistered) : @(MSALErrorDeviceNotPSSORegistered),
-                                   @(MSIDErrorPSSOKeyIdMismatch) : @(MSALErrorPSSOKeyIdMismatch),
-                                   @(MSIDErrorJITErrorHandlingConfigNotFound) : @(MSALErrorJITErrorHandlingConfigNotFound),
-                                   @(MSIDErrorPSSOBiometricPolicyMismatch) : @(MSALErrorPSSOBiometricPolicyMismatch),
-                                   @(MSIDErrorPSSOInvalidPasskeyExtension) : @(MSALErrorPSSOInvalidPasskeyExtension),
-                                   @(MSIDErrorPSSOSaveLoginConfigFailure) :@(MSALErrorPSSOSaveLoginConfigFailure),
-                                   @(MSIDErrorPSSOPasskeyLAError) :@(MSALErrorPSSOPasskeyLAError),
-                                   @(MSIDErrorPSSOBiometricsNotAvailable): @(MSALErrorPSSOBiometricsNotAvailable),
-                                   @(MSIDErrorPSSOBiometricsNotEnrolled): @(MSALErrorPSSOBiometricsNotEnrolled),
-                                
-                                   
-                                   // Oauth2 errors
-                                   @(MSIDErrorServerOauth) : @(MSALInternalErrorAuthorizationFailed),
-                                   @(MSIDErrorServerInvalidResponse) : @(MSALInternalErrorInvalidResponse),
-                                   // We don't support this error code in MSAL. This error
-                                   // exists specifically for ADAL.
-                                   @(MSIDErrorServerRefreshTokenRejected) : @(MSALErrorInternal),
-                                   @(MSIDErrorServerInvalidRequest) :@(MSALInternalErrorInvalidRequest),
-                                   @(MSIDErrorServerInvalidClient) : @(MSALInternalErrorInvalidClient),
-                                   @(MSIDErrorServerInvalidGrant) : @(MSALInternalErrorInvalidGrant),
-                                   @(MSIDErrorServerInvalidScope) : @(MSALInternalErrorInvalidScope),
-                                   @(MSIDErrorServerUnauthorizedClient): @(MSALInternalErrorUnauthorizedClient),
-                                   @(MSIDErrorServerAccessDenied): @(MSALErrorUserCanceled),
-                                   @(MSIDErrorServerDeclinedScopes): @(MSALErrorServerDeclinedScopes),
-                                   @(MSIDErrorServerError) : @(MSALErrorServerError),
-                                   @(MSIDErrorServerInvalidState) : @(MSALInternalErrorInvalidState),
-                                   @(MSIDErrorServerProtectionPoliciesRequired) : @(MSALErrorServerProtectionPoliciesRequired),
-                                   @(MSIDErrorServerUnhandledResponse) : @(MSALInternalErrorUnhandledResponse),
-                                   @(MSIDErrorUnexpectedHttpResponse) : @(MSALInternalErrorUnexpectedHttpResponse),
-                                   @(MSIDErrorServerInvalidRequestResetPasswordRequired) : @(MSALErrorServerInvalidRequestResetPasswordRequired)
-                                   }
-                           };
++ (void)initialize
+{
+    if (self != [MSALErrorConverter class]) return;
+    
+    qsort(s_errorCodeMapping, s_errorCodeMappingCount, sizeof(MSALErrorCodeMapping), MSALCompareErrorCodeMapping);
     
-    s_userInfoKeyMapping = @{
-                             MSIDHTTPHeadersKey : MSALHTTPHeadersKey,
-                             MSIDHTTPResponseCodeKey : MSALHTTPResponseCodeKey,
-                             MSIDCorrelationIdKey : MSALCorrelationIDKey,
-                             MSIDErrorDescriptionKey : MSALErrorDescriptionKey,
-                             MSIDSTSErrorCodesKey : MSALSTSErrorCodesKey,
-                             MSIDOAuthErrorKey: MSALOAuthErrorKey,
-                             MSIDOAuthSubErrorKey: MSALOAuthSubErrorKey,
-                             MSIDOAuthSubErrorDescriptionKey: MSALOAuthSubErrorDescriptionKey,
-                             MSIDDeclinedScopesKey: MSALDeclinedScopesKey,
-                             MSIDGrantedScopesKey: MSALGrantedScopesKey,
-                             MSIDUserDisplayableIdkey: MSALDisplayableUserIdKey,
-                             MSIDBrokerVersionKey: MSALBrokerVersionKey,
-                             MSIDHomeAccountIdkey: MSALHomeAccountIdKey,
-                             MSIDThrottlingCacheHitKey: MSALThrottlingCacheHitKey
-                             };
+    // Key constants are extern globals, so they can't be used in a static initializer.
+    const MSALUserInfoKeyMapping userInfoKeyMapping[] =
+    {
+        { MSIDHTTPHeadersKey, MSALHTTPHeadersKey },
+        { MSIDHTTPResponseCodeKey, MSALHTTPResponseCodeKey },
+        { MSIDCorrelationIdKey, MSALCorrelationIDKey },
+        { MSIDErrorDescriptionKey, MSALErrorDescriptionKey },
+        { MSIDSTSErrorCodesKey, MSALSTSErrorCodesKey },
+        { MSIDOAuthErrorKey, MSALOAuthErrorKey },
+        { MSIDOAuthSubErrorKey, MSALOAuthSubErrorKey },
+        { MSIDOAuthSubErrorDescriptionKey, MSALOAuthSubErrorDescriptionKey },
+        { MSIDDeclinedScopesKey, MSALDeclinedScopesKey },
+        { MSIDGrantedScopesKey, MSALGrantedScopesKey },
+        { MSIDUserDisplayableIdkey, MSALDisplayableUserIdKey },
+        { MSIDBrokerVersionKey, MSALBrokerVersionKey },
+        { MSIDHomeAccountIdkey, MSALHomeAccountIdKey },
+        { MSIDThrottlingCacheHitKey, MSALThrottlingCacheHitKey }
+    };
     
-    s_recoverableErrorCode = [[NSSet alloc] initWithObjects:@(MSALErrorWorkplaceJoinRequired), @(MSALErrorInteractionRequired), @(MSALErrorServerDeclinedScopes), @(MSALErrorServerProtectionPoliciesRequired), @(MSALErrorUserCanceled), @(MSALErrorServerInvalidRequestResetPasswordRequired), nil];
+    _Static_assert(sizeof(userInfoKeyMapping) == sizeof(s_userInfoKeyMapping), "userInfo key mapping size mismatch");
+    memcpy(s_userInfoKeyMapping, userInfoKeyMapping, sizeof(s_userInfoKeyMapping));
 }
 
 + (NSError *)msalErrorFromMsidError:(NSError *)msidError
@@ -223,45 +287,54 @@ static NSSet *s_recoverableErrorCode;
     }
     
     // Map domain
-    NSString *mappedDomain = s_errorDomainMapping[domain];
+    NSString *mappedDomain = MSALMapErrorDomain(domain);
     
     // Map errorCode
     // errorCode mapping is needed only if domain is mapped to MSALErrorDomain
-    NSNumber *mappedCode = nil;
+    BOOL hasMappedCode = NO;
+    NSInteger mappedCode = code;
     NSNumber *internalCode = nil;
-    if ([mappedDomain isEqualToString:MSALErrorDomain])
+    if (mappedDomain == MSALErrorDomain)
     {
-        mappedCode = s_errorCodeMapping[mappedDomain][@(code)];
-        if (mappedCode == nil)
+        hasMappedCode = YES;
+        if (!MSALMapErrorCode(code, &mappedCode))
         {
             MSID_LOG_WITH_CTX(MSIDLogLevelWarning,nil, @"MSALErrorConverter could not find the error code mapping entry for domain (%@) + error code (%ld).", domain, (long)code);
-            mappedCode = @(MSALErrorInternal);
+            mappedCode = MSALErrorInternal;
         }
     }
     else if ([domain isEqualToString:MSALErrorDomain])
     {
-        mappedCode = @(code);
+        hasMappedCode = YES;
         internalCode = userInfo[MSALInternalErrorCodeKey];
     }
     
-    if (shouldClassifyErrors && mappedCode != nil && ![s_recoverableErrorCode containsObject:mappedCode])
+    if (shouldClassifyErrors && hasMappedCode && !MSALIsRecoverableErrorCode(mappedCode))
     {
         if (!internalCode)
         {
             // If mapped code is MSALErrorInternal, set internalCode to MSALInternalErrorUnexpected
             // to avoid the case when both mapped and internal code are MSALErrorInternal.
-            internalCode = [mappedCode isEqual:@(MSALErrorInternal)] ? @(MSALInternalErrorUnexpected) : mappedCode;
+            internalCode = @(mappedCode == MSALErrorInternal ? MSALInternalErrorUnexpected : mappedCode);
         }
         
-        mappedCode = @(MSALErrorInternal);
+        mappedCode = MSALErrorInternal;
     }
     
-    NSMutableDictionary *msalUserInfo = [NSMutableDictionary new];
-
-    for (NSString *key in [userInfo allKeys])
+    // Copy userInfo once and rename only the MSID keys that are present.
+    NSMutableDictionary *msalUserInfo = userInfo ? [userInfo mutableCopy] : [NSMutableDictionary new];
+    
+    for (size_t i = 0; i < sizeof(s_userInfoKeyMapping) / sizeof(s_userInfoKeyMapping[0]); i++)
     {
-        NSString *mappedKey = s_userInfoKeyMapping[key] ? s_userInfoKeyMapping[key] : key;
-        msalUserInfo[mappedKey] = userInfo[key];
+        NSString *msidKey = s_userInfoKeyMapping[i].msidKey;
+        id value = userInfo[msidKey];
+        if (!value) continue;
+        
+        NSString *msalKey = s_userInfoKeyMapping[i].msalKey;
+        if ([msidKey isEqualToString:msalKey]) continue;
+        
+        [msalUserInfo removeObjectForKey:msidKey];
+        msalUserInfo[msalKey] = value;
     }
 
     if (!msalUserInfo[MSALCorrelationIDKey] && correlationId) msalUserInfo[MSALCorrelationIDKey] = correlationId;
@@ -295,7 +368,7 @@ static NSSet *s_recoverableErrorCode;
     }
 
     return [NSError errorWithDomain:mappedDomain ? : domain
-                               code:(mappedCode != nil) ? mappedCode.integerValue : code
+                               code:mappedCode
                            userInfo:msalUserInfo];
 }
 
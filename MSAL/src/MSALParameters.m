@@ -26,7 +26,18 @@
 //------------------------------------------------------------------------------
 
 #import "MSALParameters.h"
+#import "MSALParameters+Internal.h"
 
 @implementation MSALParameters
 
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    MSALParameters *parameters = [[[self class] allocWithZone:zone] init];
+    parameters.completionBlockQueue = self.completionBlockQueue;
+    parameters.cancellation = self.cancellation;
+    return parameters;
+}
+
 @end
@@ -57,6 +57,8 @@
 #import "MSALErrorConverter.h"
 #import "MSIDDefaultBrokerResponseHandler.h"
 #import "MSIDDefaultTokenResponseValidator.h"
+#import "MSALTokenResponseValidator.h"
+#import "MSALAccountSignInStateCache.h"
 #import "MSALRedirectUri.h"
 #import "MSIDConfiguration.h"
 #import "MSIDAppMetadataCacheItem.h"
@@ -96,6 +98,7 @@
 
 #import "MSIDInteractiveRequestParameters+MSALRequest.h"
 #import "MSIDTokenResult.h"
+#import "MSIDAccessToken.h"
 #import "MSIDKeychainTokenCache.h"
 #import "MSIDSignoutController.h"
 #import "MSALSignoutParameters.h"
@@ -106,9 +109,14 @@
 #import "MSIDCurrentRequestTelemetry.h"
 #import "MSIDCacheConfig.h"
 #import "MSIDDevicePopManager.h"
+#import "MSALDevicePopManager.h"
+#import "MSALMetricsRegistry.h"
+#import "MSALTelemetrySampler.h"
 #import "MSIDAssymetricKeyLookupAttributes.h"
 #import "MSIDRequestTelemetryConstants.h"
 #import "MSALWipeCacheForAllAccountsConfig.h"
+#import "MSALParameters+Internal.h"
+#import "MSALRequestCancellation.h"
 #import "NSString+MSIDTelemetryExtensions.h"
 #import "MSIDVersion.h"
 #import "MSIDCertAuthManager.h"
@@ -134,6 +142,7 @@
 @property (nonatomic) MSIDCacheConfig *msidCacheConfig;
 @property (nonatomic) MSIDDevicePopManager *popManager;
 @property (nonatomic) MSIDAssymetricKeyLookupAttributes *keyPairAttributes;
+@property (nonatomic) NSMutableSet<NSString *> *pendingTokenRevalidations;
 
 @end
 
@@ -232,12 +241,13 @@
     _keyPairAttributes.privateKeyIdentifier = MSID_POP_TOKEN_PRIVATE_KEY;
     _keyPairAttributes.keyDisplayableLabel = MSID_POP_TOKEN_KEY_LABEL;
     
-    _popManager = [[MSIDDevicePopManager alloc] initWithCacheConfig:self.msidCacheConfig keyPairAttributes:_keyPairAttributes];
+    _popManager = [[MSALDevicePopManager alloc] initWithCacheConfig:self.msidCacheConfig keyPairAttributes:_keyPairAttributes];
         
     // Maintain an internal copy of config.
     // Developers shouldn't be able to change any properties on config after PCA has been created
     _configuration = config;
     _internalConfig = [config copy];
+    _pendingTokenRevalidations = [NSMutableSet new];
     
     NSError *oauthProviderError = nil;
     self.msalOauth2Provider = [MSALOauth2ProviderFactory oauthProviderForAuthority:config.authority
@@ -437,8 +447,12 @@
 {
     MSID_LOG_WITH_CTX_PII(MSIDLogLevelInfo, nil, @"Querying MSAL accounts with parameters (identifier=%@, tenantProfileId=%@, username=%@, return only signed in accounts %d)", MSID_PII_LOG_MASKABLE(parameters.identifier), MSID_PII_LOG_MASKABLE(parameters.tenantProfileIdentifier), MSID_PII_LOG_EMAIL(parameters.username), parameters.returnOnlySignedInAccounts);
     
+    MSALRequestCancellation *cancellation = parameters.cancellation;
+    
     __auto_type block = ^(NSArray<MSALAccount *> * _Nullable accounts, NSError * _Nullable msidError)
     {
+        if (cancellation && ![cancellation tryMarkCompleted]) return;
+        
         NSError *msalError = nil;
         
         if (msidError)
@@ -466,6 +480,12 @@
         }
     };
     
+    [cancellation setCancellationHandler:^{
+        block(nil, [self.class cancelledRequestErrorWithCorrelationId:nil]);
+    }];
+    
+    if (cancellation.isCancelled) return;
+    
     MSALAccountsProvider *request = [[MSALAccountsProvider alloc] initWithTokenCache:self.tokenCache
                                                                 accountMetadataCache:self.accountMetadataCache
                                                                             clientId:self.internalConfig.clientId
@@ -589,7 +609,7 @@
 
     // Only AAD is supported in broker at this time. If we need to support something else, we need to change this to dynamically read authority from response and create factory
     MSIDDefaultBrokerResponseHandler *brokerResponseHandler = [[MSIDDefaultBrokerResponseHandler alloc] initWithOauthFactory:[MSIDAADV2Oauth2Factory new]
-                                                                                                      tokenResponseValidator:[MSIDDefaultTokenResponseValidator new]];
+                                                                                                      tokenResponseValidator:[MSALTokenResponseValidator new]];
 
     if ([MSIDBrokerInteractiveController completeAcquireToken:response
                                             sourceApplication:sourceApplication
@@ -621,8 +641,27 @@
 - (void)acquireTokenSilentWithParameters:(MSALSilentTokenParameters *)parameters
                          completionBlock:(MSALCompletionBlock)completionBlock
 {
+    MSALRequestCancellation *cancellation = parameters.cancellation;
+    uint64_t startTime = [MSALMetricsRegistry currentTime];
+    __block BOOL telemetrySampled = YES;
+    
     __auto_type block = ^(MSALResult *result, NSError *msidError, id<MSIDRequestContext> context)
     {
+        // Cancellation and request completion race, only the first one completes the request
+        if (cancellation && ![cancellation tryMarkCompleted]) return;
+        
+        [[MSALMetricsRegistry sharedRegistry] recordLatencySinceStartTime:startTime histogram:MSALMetricsHistogramSilentTokenLatency];
+        
+        if (!telemetrySampled)
+        {
+            [[MSALTelemetrySampler sharedSampler] completeUnsampledRequest:context.telemetryRequestId apiId:nil];
+            
+            if (msidError)
+            {
+                [[MSALTelemetrySampler sharedSampler] dispatchFailureEventForApiId:parameters.telemetryApiId correlationId:context.correlationId clientId:self.internalConfig.clientId error:msidError];
+            }
+        }
+        
         NSError *msalError = [MSALErrorConverter msalErrorFromMsidError:msidError classifyErrors:YES msalOauth2Provider:self.msalOauth2Provider correlationId:context.correlationId authScheme:parameters.authenticationScheme popManager:self.popManager];
         [MSALPublicClientApplication logOperation:@"acquireTokenSilent" result:result error:msalError context:context];
         
@@ -640,6 +679,10 @@
         }
     };
     
+    [cancellation setCancellationHandler:^{
+        block(nil, [self.class cancelledRequestErrorWithCorrelationId:parameters.correlationId], nil);
+    }];
+    
     if (!parameters.account)
     {
         NSError *noAccountError = MSIDCreateError(MSIDErrorDomain, MSIDErrorInteractionRequired, @"No account provided for the silent request. Please call interactive acquireToken request to get an account identifier before calling acquireTokenSilent.", nil, nil, nil, nil, nil, YES);
@@ -752,6 +795,16 @@
                                                                               sequence:nil];
 
     msidParams.tokenExpirationBuffer = self.internalConfig.tokenExpirationBuffer;
+    
+    BOOL allowStaleToken = parameters.allowStaleTokenWhileRevalidating && !parameters.forceRefresh && !parameters.claimsRequest;
+    
+    if (allowStaleToken)
+    {
+        // Accept access tokens that are up to maximumTokenStaleness seconds into the refresh window, they will be refreshed in the background
+        double staleness = MIN(MAX(self.internalConfig.maximumTokenStaleness, 0), self.internalConfig.tokenExpirationBuffer);
+        msidParams.tokenExpirationBuffer = self.internalConfig.tokenExpirationBuffer - staleness;
+    }
+    
     msidParams.claimsRequest = parameters.claimsRequest.msidClaimsRequest;
     msidParams.providedAuthority = providedAuthority;
     msidParams.instanceAware = self.internalConfig.multipleCloudsSupported;
@@ -762,6 +815,7 @@
     msidParams.currentRequestTelemetry.tokenCacheRefreshType = parameters.forceRefresh ? TokenCacheRefreshTypeForceRefresh : TokenCacheRefreshTypeNoCacheLookupInvolved;
     msidParams.allowUsingLocalCachedRtWhenSsoExtFailed = parameters.allowUsingLocalCachedRtWhenSsoExtFailed;
     msidParams.forceRefresh = parameters.forceRefresh;
+    telemetrySampled = [self applyTelemetrySamplingToParameters:msidParams apiId:parameters.telemetryApiId];
     
     // Nested auth protocol
     msidParams.nestedAuthBrokerClientId = self.internalConfig.nestedAuthBrokerClientId;
@@ -786,6 +840,9 @@
                  self.internalConfig.clientApplicationCapabilities,
                  parameters.claimsRequest);
     
+    // Don't touch keychain or network for a request that was already cancelled, completion block was called by the cancellation handler
+    if (cancellation.isCancelled) return;
+    
     // Return early if account is in signed out state
     NSError *signInStateError;
     MSIDAccountMetadataState signInState = [self accountStateForParameters:msidParams error:&signInStateError];
@@ -806,7 +863,7 @@
     MSIDDefaultTokenRequestProvider *tokenRequestProvider = [[MSIDDefaultTokenRequestProvider alloc] initWithOauthFactory:self.msalOauth2Provider.msidOauth2Factory
                                                                                                           defaultAccessor:self.tokenCache
                                                                                                   accountMetadataAccessor:self.accountMetadataCache
-                                                                                                   tokenResponseValidator:[MSIDDefaultTokenResponseValidator new]];
+                                                                                                   tokenResponseValidator:[MSALTokenResponseValidator new]];
 #if TARGET_OS_OSX
     tokenRequestProvider.externalCacheSeeder = self.externalCacheSeeder;
 #endif
@@ -823,9 +880,13 @@
         block(nil, requestError, msidParams);
         return;
     }
+    
+    if (cancellation.isCancelled) return;
         
     [requestController acquireToken:^(MSIDTokenResult * _Nullable result, NSError * _Nullable error) {
         
+        MSALMetricsRegistry *metrics = [MSALMetricsRegistry sharedRegistry];
+        
         if (error)
         {
             block(nil, error, msidParams);
@@ -835,16 +896,78 @@
         NSError *resultError = nil;
         MSALResult *msalResult = [self.msalOauth2Provider resultWithTokenResult:result authScheme:parameters.authenticationScheme popManager:self.popManager error:&resultError];
         
+        [metrics incrementCounter:result.tokenResponse ? MSALMetricsCounterCacheMiss : MSALMetricsCounterCacheHit];
+        
         if (result.tokenResponse)
         {
             // Only update external accounts if we got new result from network as an optimization
             [self updateExternalAccountsWithResult:msalResult context:msidParams];
         }
+        else if (allowStaleToken
+                 && msalResult
+                 && [result.accessToken.expiresOn timeIntervalSinceNow] < self.internalConfig.tokenExpirationBuffer)
+        {
+            [self revalidateTokenInBackgroundWithParameters:parameters context:msidParams];
+        }
         
         block(msalResult, resultError, msidParams);
     }];
 }
 
+- (void)revalidateTokenInBackgroundWithParameters:(MSALSilentTokenParameters *)parameters context:(id<MSIDRequestContext>)context
+{
+    NSArray *sortedScopes = [[parameters.scopes valueForKey:@"lowercaseString"] sortedArrayUsingSelector:@selector(compare:)];
+    NSString *revalidationKey = [NSString stringWithFormat:@"%@|%@|%@", parameters.account.identifier, parameters.authority.url.absoluteString, [sortedScopes componentsJoinedByString:@" "]];
+    
+    @synchronized (self.pendingTokenRevalidations)
+    {
+        // Coalesce revalidations of the same token, the first one will update the cache for everybody
+        if ([self.pendingTokenRevalidations containsObject:revalidationKey]) return;
+        
+        [self.pendingTokenRevalidations addObject:revalidationKey];
+    }
+    
+    MSID_LOG_WITH_CTX(MSIDLogLevelInfo, context, @"Returned access token is inside the refresh window, refreshing it in the background.");
+    
+    MSALSilentTokenParameters *revalidationParameters = [[MSALSilentTokenParameters alloc] initWithScopes:parameters.scopes account:parameters.account];
+    revalidationParameters.authority = parameters.authority;
+    revalidationParameters.authenticationScheme = parameters.authenticationScheme;
+    revalidationParameters.extraQueryParameters = parameters.extraQueryParameters;
+    revalidationParameters.allowUsingLocalCachedRtWhenSsoExtFailed = parameters.allowUsingLocalCachedRtWhenSsoExtFailed;
+    revalidationParameters.telemetryApiId = parameters.telemetryApiId;
+#if TARGET_OS_OSX
+    revalidationParameters.msalXpcMode = parameters.msalXpcMode;
+#endif
+    
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        [self acquireTokenSilentWithParameters:revalidationParameters completionBlock:^(__unused MSALResult *result, NSError *error) {
+            
+            if (error)
+            {
+                MSID_LOG_WITH_CTX(MSIDLogLevelWarning, nil, @"Background token revalidation failed with error %@, %ld", error.domain, (long)error.code);
+            }
+            
+            @synchronized (self.pendingTokenRevalidations)
+            {
+                [self.pendingTokenRevalidations removeObject:revalidationKey];
+            }
+        }];
+    });
+}
+
+- (BOOL)applyTelemetrySamplingToParameters:(MSIDRequestParameters *)msidParams apiId:(NSInteger)apiId
+{
+    if ([[MSALTelemetrySampler sharedSampler] shouldSampleApiId:apiId correlationId:msidParams.correlationId])
+    {
+        return YES;
+    }
+    
+    // The request keeps its telemetry request id, the sampled aggregated dispatcher drops its events
+    MSID_LOG_WITH_CTX(MSIDLogLevelVerbose, msidParams, @"Request not sampled for telemetry.");
+    [[MSALTelemetrySampler sharedSampler] markUnsampledRequest:msidParams.telemetryRequestId apiId:apiId];
+    return NO;
+}
+
 - (MSIDAccountMetadataState)accountStateForParameters:(MSIDRequestParameters *)msidParams error:(NSError **)signInStateError
 {
     if (!msidParams.accountIdentifier.homeAccountId)
@@ -852,14 +975,30 @@
         return MSIDAccountMetadataStateUnknown;
     }
     
+    MSIDAccountMetadataState cachedSignInState = [[MSALAccountSignInStateCache sharedCache] signInStateForHomeAccountId:msidParams.accountIdentifier.homeAccountId
+                                                                                                               clientId:self.internalConfig.clientId
+                                                                                                          keychainGroup:self.internalConfig.cacheConfig.keychainSharingGroup];
+    
+    if (cachedSignInState != MSIDAccountMetadataStateUnknown)
+    {
+        return cachedSignInState;
+    }
+    
     MSALAccountsProvider *accountsProvider = [[MSALAccountsProvider alloc] initWithTokenCache:self.tokenCache
                                                                          accountMetadataCache:self.accountMetadataCache
                                                                                      clientId:self.internalConfig.clientId
                                                                       externalAccountProvider:self.externalAccountHandler];
 
+    uint64_t startTime = [MSALMetricsRegistry currentTime];
     MSIDAccountMetadataState signInState = [accountsProvider signInStateForHomeAccountId:msidParams.accountIdentifier.homeAccountId
                                                                                  context:msidParams
                                                                                    error:signInStateError];
+    [[MSALMetricsRegistry sharedRegistry] recordLatencySinceStartTime:startTime histogram:MSALMetricsHistogramSignInStateReadLatency];
+    
+    [[MSALAccountSignInStateCache sharedCache] setSignInState:signInState
+                                             forHomeAccountId:msidParams.accountIdentifier.homeAccountId
+                                                     clientId:self.internalConfig.clientId
+                                                keychainGroup:self.internalConfig.cacheConfig.keychainSharingGroup];
     
     return signInState;
 }
@@ -942,8 +1081,20 @@
 - (void)acquireTokenWithParameters:(MSALInteractiveTokenParameters *)parameters
                    completionBlock:(MSALCompletionBlock)completionBlock
 {
+    __block BOOL telemetrySampled = YES;
+    
     __auto_type block = ^(MSALResult *result, NSError *msidError, id<MSIDRequestContext> context)
     {
+        if (!telemetrySampled)
+        {
+            [[MSALTelemetrySampler sharedSampler] completeUnsampledRequest:context.telemetryRequestId apiId:nil];
+            
+            if (msidError)
+            {
+                [[MSALTelemetrySampler sharedSampler] dispatchFailureEventForApiId:parameters.telemetryApiId correlationId:context.correlationId clientId:self.internalConfig.clientId error:msidError];
+            }
+        }
+        
         NSError *msalError = [MSALErrorConverter msalErrorFromMsidError:msidError classifyErrors:YES msalOauth2Provider:self.msalOauth2Provider correlationId:context.correlationId authScheme:parameters.authenticationScheme popManager:self.popManager];
         [MSALPublicClientApplication logOperation:@"acquireToken" result:result error:msalError context:context];
         
@@ -1087,6 +1238,7 @@
     msidParams.currentRequestTelemetry.schemaVersion = HTTP_REQUEST_TELEMETRY_SCHEMA_VERSION;
     msidParams.currentRequestTelemetry.apiId = [msidParams.telemetryApiId integerValue];
     msidParams.currentRequestTelemetry.tokenCacheRefreshType = TokenCacheRefreshTypeNoCacheLookupInvolved;
+    telemetrySampled = [self applyTelemetrySamplingToParameters:msidParams apiId:parameters.telemetryApiId];
 #if TARGET_OS_OSX && DEBUG
     msidParams.xpcMode = (NSUInteger)parameters.msalXpcMode;
 #elif TARGET_OS_OSX
@@ -1143,7 +1295,7 @@
     MSIDDefaultTokenRequestProvider *tokenRequestProvider = [[MSIDDefaultTokenRequestProvider alloc] initWithOauthFactory:self.msalOauth2Provider.msidOauth2Factory
                                                                                                           defaultAccessor:self.tokenCache
                                                                                                   accountMetadataAccessor:self.accountMetadataCache
-                                                                                                   tokenResponseValidator:[MSIDDefaultTokenResponseValidator new]];
+                                                                                                   tokenResponseValidator:[MSALTokenResponseValidator new]];
 #if TARGET_OS_OSX
     tokenRequestProvider.externalCacheSeeder = self.externalCacheSeeder;
 #endif
@@ -1195,6 +1347,7 @@
     // If developer is passing a wipeAccount flag, we want to wipe cache for any clientId
     NSString *clientId = wipeAccount ? nil : self.internalConfig.clientId;
 
+    uint64_t startTime = [MSALMetricsRegistry currentTime];
     BOOL result = [self.tokenCache clearCacheForAccount:account.lookupAccountIdentifier
                                               authority:nil
                                                clientId:clientId
@@ -1202,6 +1355,7 @@
                                           clearAccounts:wipeAccount
                                                 context:nil
                                                   error:&msidError];
+    [[MSALMetricsRegistry sharedRegistry] recordLatencySinceStartTime:startTime histogram:MSALMetricsHistogramKeychainWriteLatency];
     if (!result)
     {
         MSID_LOG_WITH_CTX(MSIDLogLevelError, nil, @"Clearing MSAL token cache for the specified account failed with error %@", MSID_PII_LOG_MASKABLE(msidError));
@@ -1241,6 +1395,11 @@
         return NO;
     }
     
+    [[MSALAccountSignInStateCache sharedCache] setSignInState:MSIDAccountMetadataStateSignedOut
+                                             forHomeAccountId:account.identifier
+                                                     clientId:self.internalConfig.clientId
+                                                keychainGroup:self.internalConfig.cacheConfig.keychainSharingGroup];
+    
     return YES;
 }
 
@@ -1357,6 +1516,7 @@
         NSError *localError;
         
         result = [self.tokenCache clearCacheForAllAccountsWithContext:nil error:&localError];
+        [[MSALAccountSignInStateCache sharedCache] removeAllStates];
         
         if (!result)
         {
@@ -1451,8 +1611,12 @@
     NSError *requestParamsError;
     MSIDRequestParameters *requestParams = [self defaultRequestParametersWithError:&requestParamsError];
 
+    MSALRequestCancellation *cancellation = parameters.cancellation;
+
     __auto_type block = ^(MSALDeviceInformation * _Nullable deviceInformation, NSError * _Nullable msidError)
     {
+        if (cancellation && ![cancellation tryMarkCompleted]) return;
+        
         NSError *msalError = nil;
         
         if (msidError)
@@ -1487,6 +1651,12 @@
         return;
     }
     
+    [cancellation setCancellationHandler:^{
+        block(nil, [self.class cancelledRequestErrorWithCorrelationId:requestParams.correlationId]);
+    }];
+    
+    if (cancellation.isCancelled) return;
+    
     MSALDeviceInfoProvider *deviceInfoProvider = [MSALDeviceInfoProvider new];
     [deviceInfoProvider deviceInfoWithRequestParameters:requestParams completionBlock:block];
 }
@@ -1795,6 +1965,11 @@
     return requestType;
 }
 
++ (NSError *)cancelledRequestErrorWithCorrelationId:(NSUUID *)correlationId
+{
+    return MSIDCreateError(MSIDErrorDomain, MSIDErrorUserCancel, @"Request was cancelled by the caller.", nil, nil, nil, correlationId, nil, YES);
+}
+
 - (MSIDAuthority *)interactiveRequestAuthorityWithCustomAuthority:(MSIDAuthority *)customAuthority
                                                             error:(NSError **)error
 {
@@ -44,6 +44,10 @@
 #import "MSIDDevicePopManager.h"
 #import "MSALAuthenticationSchemeProtocol.h"
 #import "MSALAuthenticationSchemeProtocolInternal.h"
+#import "MSALIdTokenClaimsCache.h"
+#import "MSALAuthenticationSchemePop+Internal.h"
+#import "MSALDevicePopManager.h"
+#import "MSALErrorConverter.h"
 
 @interface MSALResult()
 
@@ -51,6 +55,10 @@
 
 @property (atomic, nullable) NSString *refreshToken;
 
+// Raw access token and pop manager kept for PoP results, so that additional requests can be signed without a new silent call.
+@property (atomic, nullable) MSIDAccessToken *popAccessToken;
+@property (atomic, nullable) MSIDDevicePopManager *popManager;
+
 @end
 
 @implementation MSALResult
@@ -70,6 +78,73 @@
     return self.authScheme.authenticationScheme;
 }
 
+- (NSArray<NSString *> *)authorizationHeadersForPopSchemes:(NSArray<MSALAuthenticationSchemePop *> *)popSchemes
+                                                     error:(NSError **)error
+{
+    MSIDAccessToken *accessToken = self.popAccessToken;
+    MSIDDevicePopManager *popManager = self.popManager;
+    
+    if (!accessToken || !popManager)
+    {
+        NSError *msidError = MSIDCreateError(MSIDErrorDomain, MSIDErrorInvalidDeveloperParameter, @"Result doesn't contain a Proof-of-Possession access token.", nil, nil, nil, self.correlationId, nil, YES);
+        if (error) *error = [MSALErrorConverter msalErrorFromMsidError:msidError];
+        return nil;
+    }
+    
+    for (id popScheme in popSchemes)
+    {
+        if (![popScheme isKindOfClass:MSALAuthenticationSchemePop.class])
+        {
+            NSError *msidError = MSIDCreateError(MSIDErrorDomain, MSIDErrorInvalidDeveloperParameter, @"Only MSALAuthenticationSchemePop schemes can be signed.", nil, nil, nil, self.correlationId, nil, YES);
+            if (error) *error = [MSALErrorConverter msalErrorFromMsidError:msidError];
+            return nil;
+        }
+    }
+    
+    if ([popManager isKindOfClass:MSALDevicePopManager.class])
+    {
+        // Load the key once up front, all signing blocks then share the same key handle.
+        [(MSALDevicePopManager *)popManager keyMaterial];
+    }
+    
+    NSUInteger count = popSchemes.count;
+    NSMutableArray *headers = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++)
+    {
+        [headers addObject:[NSNull null]];
+    }
+    
+    __block NSError *signingError = nil;
+    
+    dispatch_apply(count, DISPATCH_APPLY_AUTO, ^(size_t i) {
+        MSALAuthenticationSchemePop *popScheme = popSchemes[i];
+        NSError *localError;
+        NSString *signedAccessToken = [popScheme getClientAccessToken:accessToken popManager:popManager error:&localError];
+        NSString *header = signedAccessToken ? [popScheme getAuthorizationHeader:signedAccessToken] : nil;
+        
+        @synchronized (headers)
+        {
+            if (header)
+            {
+                headers[i] = header;
+            }
+            else if (!signingError)
+            {
+                signingError = localError;
+            }
+        }
+    });
+    
+    if (signingError)
+    {
+        MSID_LOG_WITH_CTX(MSIDLogLevelError, nil, @"Failed to sign %lu PoP requests.", (unsigned long)count);
+        if (error) *error = [MSALErrorConverter msalErrorFromMsidError:signingError];
+        return nil;
+    }
+    
+    return [headers copy];
+}
+
 @end
 
 @implementation MSALResult (Internal)
@@ -113,7 +188,8 @@
         return nil;
     }
     
-    MSIDIdTokenClaims *claims = [[MSIDIdTokenClaims alloc] initWithRawIdToken:tokenResult.rawIdToken error:error];
+    // Cache served results repeat the same id token, reuse its parsed claims
+    NSDictionary *claims = [[MSALIdTokenClaimsCache sharedCache] claimsForRawIdToken:tokenResult.rawIdToken error:error];
     
     if (!claims)
     {
@@ -130,13 +206,13 @@
                                                                             tenantId:tokenResult.account.realm
                                                                          environment:tokenResult.account.environment
                                                                  isHomeTenantProfile:tokenResult.account.isHomeTenantAccount
-                                                                              claims:claims.jsonDictionary];
+                                                                              claims:claims];
     
     MSALAccount *account = [[MSALAccount alloc] initWithMSIDAccount:tokenResult.account createTenantProfile:NO];
     
     if (tokenResult.account.isHomeTenantAccount)
     {
-        account.accountClaims = claims.jsonDictionary;
+        account.accountClaims = claims;
     }
     
     NSString *resultAccessToken = @"";
@@ -153,17 +229,25 @@
         MSID_LOG_WITH_CTX(MSIDLogLevelInfo, nil, @"Access token missing in token result. Continuing without it");
     }
         
-    return [self resultWithAccessToken:resultAccessToken
-                          refreshToken:tokenResult.refreshToken.refreshToken
-                             expiresOn:tokenResult.accessToken.expiresOn
-               isExtendedLifetimeToken:tokenResult.extendedLifeTimeToken
-                         tenantProfile:tenantProfile
-                               account:account
-                               idToken:tokenResult.rawIdToken
-                                scopes:resultScopes
-                             authority:authority
-                         correlationId:tokenResult.correlationId
-                            authScheme:authScheme];
+    MSALResult *result = [self resultWithAccessToken:resultAccessToken
+                                        refreshToken:tokenResult.refreshToken.refreshToken
+                                           expiresOn:tokenResult.accessToken.expiresOn
+                             isExtendedLifetimeToken:tokenResult.extendedLifeTimeToken
+                                       tenantProfile:tenantProfile
+                                             account:account
+                                             idToken:tokenResult.rawIdToken
+                                              scopes:resultScopes
+                                           authority:authority
+                                       correlationId:tokenResult.correlationId
+                                          authScheme:authScheme];
+    
+    if (authScheme.scheme == MSALAuthSchemePop && resultAccessToken.length && popManager)
+    {
+        result.popAccessToken = tokenResult.accessToken;
+        result.popManager = popManager;
+    }
+    
+    return result;
 }
 
 @end
@@ -27,6 +27,7 @@
 
 #import "MSALSilentTokenParameters.h"
 #import "MSALTokenParameters+Internal.h"
+#import "MSALParameters+Internal.h"
 
 @implementation MSALSilentTokenParameters
 
@@ -45,4 +46,16 @@
     return self;
 }
 
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    MSALSilentTokenParameters *parameters = [super copyWithZone:zone];
+    parameters.telemetryApiId = self.telemetryApiId;
+    parameters.forceRefresh = self.forceRefresh;
+    parameters.allowUsingLocalCachedRtWhenSsoExtFailed = self.allowUsingLocalCachedRtWhenSsoExtFailed;
+    parameters.allowStaleTokenWhileRevalidating = self.allowStaleTokenWhileRevalidating;
+    return parameters;
+}
+
 @end
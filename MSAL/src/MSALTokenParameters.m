@@ -26,6 +26,7 @@
 //------------------------------------------------------------------------------
 
 #import "MSALTokenParameters.h"
+#import "MSALParameters+Internal.h"
 #import "MSALAuthenticationSchemeBearer.h"
 
 @implementation MSALTokenParameters
@@ -42,4 +43,22 @@
     return self;
 }
 
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    MSALTokenParameters *parameters = [super copyWithZone:zone];
+    parameters.scopes = self.scopes;
+    parameters.account = self.account;
+    parameters.authority = self.authority;
+    parameters.claimsRequest = self.claimsRequest;
+    parameters.extraQueryParameters = self.extraQueryParameters;
+    parameters.correlationId = self.correlationId;
+    parameters.authenticationScheme = self.authenticationScheme;
+#if TARGET_OS_OSX
+    parameters.msalXpcMode = self.msalXpcMode;
+#endif
+    return parameters;
+}
+
 @end
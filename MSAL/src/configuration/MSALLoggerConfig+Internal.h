@@ -33,4 +33,20 @@
 
 @property (nonatomic, copy) MSALLogCallback callback;
 
+/// Starts capturing the log lines of the request with correlationId when captureLogsForFailedRequests is enabled.
+/// The global log level isn't changed, loggers that know the request context check isCapturingLogsForCorrelationId:
+/// for lines above it and hand them to captureLogWithLevel:message:containsPII:correlationId:.
+- (void)beginLogCaptureForCorrelationId:(NSUUID *)correlationId;
+
+/// Delivers the captured log lines to the logging callback if the request failed, otherwise discards them.
+- (void)endLogCaptureForCorrelationId:(NSUUID *)correlationId error:(NSError *)error;
+
+- (BOOL)isCapturingLogsForCorrelationId:(NSUUID *)correlationId;
+
+/// Prefixes message with a timestamp and correlationId and stores it for the request, without delivering it.
+- (void)captureLogWithLevel:(MSALLogLevel)level
+                    message:(NSString *)message
+                containsPII:(BOOL)containsPII
+              correlationId:(NSUUID *)correlationId;
+
 @end
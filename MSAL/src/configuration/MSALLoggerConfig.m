@@ -27,9 +27,20 @@
 
 #import "MSALLoggerConfig+Internal.h"
 #import "MSIDLogger.h"
+#import "MSALAsyncLogQueue.h"
+#import "MSALRequestLogCapture.h"
+
+@interface MSALLoggerConfig()
+
+@property (atomic) MSALAsyncLogQueue *logQueue;
+@property (nonatomic) MSALRequestLogCapture *requestLogCapture;
+
+@end
 
 @implementation MSALLoggerConfig
 
+@synthesize captureLogsForFailedRequests = _captureLogsForFailedRequests;
+
 + (instancetype)sharedInstance
 {
     static dispatch_once_t once;
@@ -37,13 +48,13 @@
     
     dispatch_once(&once, ^{
         s_loggerConfig = [[self.class alloc] init];
+        s_loggerConfig.requestLogCapture = [MSALRequestLogCapture new];
         
         [[MSIDLogger sharedLogger] setCallback:^(MSIDLogLevel level, NSString *message, BOOL containsPII) {
             
-            if (s_loggerConfig->_callback)
-            {
-                s_loggerConfig->_callback((MSALLogLevel)level, message, containsPII);
-            }
+            if (!s_loggerConfig->_callback) return;
+            
+            [s_loggerConfig deliverLogWithLevel:(MSALLogLevel)level message:message containsPII:containsPII];
             
         }];
     });
@@ -70,6 +81,130 @@
     });
 }
 
+#pragma mark - Asynchronous delivery
+
+- (void)enableAsynchronousLogDeliveryWithQueueCapacity:(NSUInteger)capacity
+                                        overflowPolicy:(MSALLogOverflowPolicy)overflowPolicy
+{
+    @synchronized (self)
+    {
+        if (self.logQueue)
+        {
+            MSID_LOG_WITH_CTX(MSIDLogLevelWarning, nil, @"Asynchronous log delivery is already enabled.");
+            return;
+        }
+        
+        __weak typeof(self) weakSelf = self;
+        self.logQueue = [[MSALAsyncLogQueue alloc] initWithCapacity:capacity
+                                                     overflowPolicy:overflowPolicy
+                                                           callback:^(MSALLogLevel level, NSString *message, BOOL containsPII) {
+            MSALLogCallback callback = weakSelf.callback;
+            if (callback) callback(level, message, containsPII);
+        }];
+    }
+}
+
+- (BOOL)asynchronousLogDeliveryEnabled
+{
+    return self.logQueue != nil;
+}
+
+- (NSUInteger)droppedLogCount
+{
+    return self.logQueue.droppedLogCount;
+}
+
+- (void)flushLogs
+{
+    [self.logQueue flush];
+}
+
+- (void)deliverLogWithLevel:(MSALLogLevel)level message:(NSString *)message containsPII:(BOOL)containsPII
+{
+    MSALAsyncLogQueue *logQueue = self.logQueue;
+    if (logQueue)
+    {
+        [logQueue enqueueLogWithLevel:level message:message containsPII:containsPII];
+    }
+    else
+    {
+        _callback(level, message, containsPII);
+    }
+}
+
+#pragma mark - Failed request logs
+
+- (void)setCaptureLogsForFailedRequests:(BOOL)captureLogsForFailedRequests
+{
+    _captureLogsForFailedRequests = captureLogsForFailedRequests;
+    
+    if (!captureLogsForFailedRequests) [self.requestLogCapture discardAllCaptures];
+}
+
+- (BOOL)captureLogsForFailedRequests
+{
+    return _captureLogsForFailedRequests;
+}
+
+- (void)setMaxCapturedLogLinesPerRequest:(NSUInteger)maxCapturedLogLinesPerRequest
+{
+    self.requestLogCapture.maxLinesPerRequest = maxCapturedLogLinesPerRequest;
+}
+
+- (NSUInteger)maxCapturedLogLinesPerRequest
+{
+    return self.requestLogCapture.maxLinesPerRequest;
+}
+
+- (void)beginLogCaptureForCorrelationId:(NSUUID *)correlationId
+{
+    if (!correlationId || !self.captureLogsForFailedRequests || !_callback) return;
+    
+    [self.requestLogCapture beginCaptureForCorrelationId:correlationId];
+}
+
+- (void)endLogCaptureForCorrelationId:(NSUUID *)correlationId error:(NSError *)error
+{
+    if (!correlationId) return;
+    
+    NSArray<MSALCapturedLogLine *> *lines = [self.requestLogCapture endCaptureForCorrelationId:correlationId];
+    
+    if (!error || !_callback) return;
+    
+    for (MSALCapturedLogLine *line in lines)
+    {
+        [self deliverLogWithLevel:line.level message:line.message containsPII:line.containsPII];
+    }
+}
+
+- (BOOL)isCapturingLogsForCorrelationId:(NSUUID *)correlationId
+{
+    return [self.requestLogCapture isCapturingCorrelationId:correlationId];
+}
+
+- (void)captureLogWithLevel:(MSALLogLevel)level
+                    message:(NSString *)message
+                containsPII:(BOOL)containsPII
+              correlationId:(NSUUID *)correlationId
+{
+    if (!correlationId) return;
+    
+    static NSDateFormatter *s_dateFormatter;
+    static dispatch_once_t once;
+    dispatch_once(&once, ^{
+        s_dateFormatter = [NSDateFormatter new];
+        s_dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+        s_dateFormatter.timeZone = [NSTimeZone timeZoneWithAbbreviation:@"UTC"];
+        s_dateFormatter.dateFormat = @"yyyy-MM-dd HH:mm:ss";
+    });
+    
+    // Same "[<timestamp> - <correlation id>] <message>" shape and PII flag as the lines MSIDLogger delivers.
+    NSString *line = [NSString stringWithFormat:@"[%@ - %@] %@", [s_dateFormatter stringFromDate:[NSDate date]], correlationId.UUIDString, message];
+    BOOL lineContainsPII = containsPII && self.logMaskingLevel != MSALLogMaskingSettingsMaskAllPII;
+    
+    [self.requestLogCapture captureLogWithLevel:level message:line containsPII:lineContainsPII correlationId:correlationId];
+}
+
 #pragma mark - Level
 
 - (void)setLogLevel:(MSALLogLevel)level
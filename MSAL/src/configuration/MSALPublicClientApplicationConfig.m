@@ -34,6 +34,7 @@
 #import "MSIDConstants.h"
 
 static double defaultTokenExpirationBuffer = 300; //in seconds, ensures catching of clock differences between the server and the device
+static double defaultMaximumTokenStaleness = 240; //in seconds, keeps at least a minute of validity on tokens returned while revalidating
 
 @implementation MSALPublicClientApplicationConfig
 {
@@ -66,6 +67,7 @@ static double defaultTokenExpirationBuffer = 300; //in seconds, ensures catching
         
         _cacheConfig = [MSALCacheConfig defaultConfig];
         _tokenExpirationBuffer = defaultTokenExpirationBuffer;
+        _maximumTokenStaleness = defaultMaximumTokenStaleness;
     }
     
     return self;
@@ -125,6 +127,7 @@ static double defaultTokenExpirationBuffer = 300; //in seconds, ensures catching
     }
     
     item->_tokenExpirationBuffer = _tokenExpirationBuffer;
+    item->_maximumTokenStaleness = _maximumTokenStaleness;
     item->_sliceConfig = [_sliceConfig copyWithZone:zone];
     item->_cacheConfig = [_cacheConfig copyWithZone:zone];
     item->_verifiedRedirectUri = [_verifiedRedirectUri copyWithZone:zone];
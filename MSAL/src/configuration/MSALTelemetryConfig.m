@@ -30,7 +30,9 @@
 #import "MSIDTelemetry.h"
 #import "MSIDTelemetry+Internal.h"
 #import "MSALTelemetryEventsObservingProxy.h"
-#import "MSIDAggregatedDispatcher.h"
+#import "MSALSampledAggregatedDispatcher.h"
+#import "MSALMetricsRegistry.h"
+#import "MSALTelemetrySampler.h"
 
 @interface MSALTelemetryConfig()
 
@@ -72,6 +74,81 @@
     MSIDTelemetry.sharedInstance.notifyOnFailureOnly = notifyOnFailureOnly;
 }
 
+- (MSALTelemetryBatchCallback)telemetryBatchCallback
+{
+    return self.proxyObserver.batchCallback;
+}
+
+- (void)setTelemetryBatchCallback:(MSALTelemetryBatchCallback)telemetryBatchCallback
+{
+    self.proxyObserver.batchCallback = telemetryBatchCallback;
+}
+
+- (NSUInteger)batchSize
+{
+    return self.proxyObserver.batchSize;
+}
+
+- (void)setBatchSize:(NSUInteger)batchSize
+{
+    self.proxyObserver.batchSize = batchSize;
+}
+
+- (NSTimeInterval)batchFlushInterval
+{
+    return self.proxyObserver.batchFlushInterval;
+}
+
+- (void)setBatchFlushInterval:(NSTimeInterval)batchFlushInterval
+{
+    self.proxyObserver.batchFlushInterval = batchFlushInterval;
+}
+
+- (NSUInteger)droppedEventCount
+{
+    return self.proxyObserver.droppedEventCount;
+}
+
+- (void)flushTelemetryBatch
+{
+    [self.proxyObserver flushBatch];
+}
+
+- (double)samplingRate
+{
+    return [MSALTelemetrySampler sharedSampler].defaultSamplingRate;
+}
+
+- (void)setSamplingRate:(double)samplingRate
+{
+    [MSALTelemetrySampler sharedSampler].defaultSamplingRate = samplingRate;
+}
+
+- (void)setSamplingRate:(double)samplingRate forApiId:(NSInteger)apiId
+{
+    [[MSALTelemetrySampler sharedSampler] setSamplingRate:samplingRate forApiId:apiId];
+}
+
+- (double)samplingRateForApiId:(NSInteger)apiId
+{
+    return [[MSALTelemetrySampler sharedSampler] samplingRateForApiId:apiId];
+}
+
+- (void)removeAllSamplingRates
+{
+    [[MSALTelemetrySampler sharedSampler] removeAllSamplingRates];
+}
+
+- (MSALMetricsSnapshot)metricsSnapshot
+{
+    return [[MSALMetricsRegistry sharedRegistry] snapshot];
+}
+
+- (void)resetMetrics
+{
+    [[MSALMetricsRegistry sharedRegistry] reset];
+}
+
 #pragma mark - Private
 
 - (void)initDispatchers
@@ -81,7 +158,8 @@
     {
         if (self.telemetryCallback != nil) self.telemetryCallback(event);
     };
-    __auto_type aggregatedDispatcher = [[MSIDAggregatedDispatcher alloc] initWithObserver:aggregatedProxyObserver];
+    self.proxyObserver = aggregatedProxyObserver;
+    __auto_type aggregatedDispatcher = [[MSALSampledAggregatedDispatcher alloc] initWithObserver:aggregatedProxyObserver];
     
     [[MSIDTelemetry sharedInstance] addDispatcher:aggregatedDispatcher];
 }
@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <Foundation/Foundation.h>
+#import "MSIDAccountMetadata.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ Process wide in-memory mirror of the account sign-in state stored in MSIDAccountMetadataCacheAccessor, keyed by client id, keychain group and home account id.
+ It lets the silent token path rule out signed out accounts without a keychain read.
+ Entries are written whenever MSAL changes the sign-in state and populated from the keychain on a miss.
+ They expire after stateLifetime, so changes made to the keychain by another process or app in the same group are picked up.
+ */
+@interface MSALAccountSignInStateCache : NSObject
+
++ (instancetype)sharedCache NS_SWIFT_NAME(shared());
+
+/*!
+ Seconds after which a cached state is ignored and the keychain is read again. Defaults to 30 seconds.
+ */
+@property (nonatomic) NSTimeInterval stateLifetime;
+
+/*!
+ Returns MSIDAccountMetadataStateUnknown when no state, or only an expired one, is cached for the account.
+ */
+- (MSIDAccountMetadataState)signInStateForHomeAccountId:(NSString *)homeAccountId
+                                               clientId:(NSString *)clientId
+                                          keychainGroup:(nullable NSString *)keychainGroup;
+
+- (void)setSignInState:(MSIDAccountMetadataState)state
+      forHomeAccountId:(NSString *)homeAccountId
+              clientId:(NSString *)clientId
+         keychainGroup:(nullable NSString *)keychainGroup;
+
+/*!
+ Drops the cached state of the account in every keychain group, for callers that don't know which group was written.
+ */
+- (void)removeSignInStatesForHomeAccountId:(NSString *)homeAccountId
+                                  clientId:(NSString *)clientId;
+
+- (void)removeAllStates;
+
+@end
+
+NS_ASSUME_NONNULL_END
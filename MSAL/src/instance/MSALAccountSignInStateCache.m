@@ -0,0 +1,161 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import "MSALAccountSignInStateCache.h"
+
+static const NSTimeInterval MSALDefaultSignInStateLifetime = 30;
+
+@interface MSALAccountSignInStateCacheEntry : NSObject
+
+@property (nonatomic) MSIDAccountMetadataState state;
+@property (nonatomic) NSTimeInterval storedAt;
+
+@end
+
+@implementation MSALAccountSignInStateCacheEntry
+@end
+
+@interface MSALAccountSignInStateCache()
+
+@property (nonatomic) NSMutableDictionary<NSString *, NSMutableDictionary<NSString *, MSALAccountSignInStateCacheEntry *> *> *statesByCacheKey;
+
+@end
+
+@implementation MSALAccountSignInStateCache
+
++ (instancetype)sharedCache
+{
+    static MSALAccountSignInStateCache *sharedCache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [MSALAccountSignInStateCache new];
+    });
+    
+    return sharedCache;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self)
+    {
+        _statesByCacheKey = [NSMutableDictionary new];
+        _stateLifetime = MSALDefaultSignInStateLifetime;
+    }
+    return self;
+}
+
+- (MSIDAccountMetadataState)signInStateForHomeAccountId:(NSString *)homeAccountId
+                                               clientId:(NSString *)clientId
+                                          keychainGroup:(NSString *)keychainGroup
+{
+    if (!homeAccountId || !clientId) return MSIDAccountMetadataStateUnknown;
+    
+    @synchronized (self)
+    {
+        NSMutableDictionary *states = self.statesByCacheKey[[self cacheKeyForClientId:clientId keychainGroup:keychainGroup]];
+        MSALAccountSignInStateCacheEntry *entry = states[homeAccountId];
+        if (!entry) return MSIDAccountMetadataStateUnknown;
+        
+        if ([self currentTime] - entry.storedAt >= self.stateLifetime)
+        {
+            [states removeObjectForKey:homeAccountId];
+            return MSIDAccountMetadataStateUnknown;
+        }
+        
+        return entry.state;
+    }
+}
+
+- (void)setSignInState:(MSIDAccountMetadataState)state
+      forHomeAccountId:(NSString *)homeAccountId
+              clientId:(NSString *)clientId
+         keychainGroup:(NSString *)keychainGroup
+{
+    if (!homeAccountId || !clientId) return;
+    
+    @synchronized (self)
+    {
+        NSString *cacheKey = [self cacheKeyForClientId:clientId keychainGroup:keychainGroup];
+        NSMutableDictionary *states = self.statesByCacheKey[cacheKey];
+        
+        if (!states)
+        {
+            states = [NSMutableDictionary new];
+            self.statesByCacheKey[cacheKey] = states;
+        }
+        
+        // Unknown is the miss marker, don't keep it around
+        if (state == MSIDAccountMetadataStateUnknown)
+        {
+            [states removeObjectForKey:homeAccountId];
+            return;
+        }
+        
+        MSALAccountSignInStateCacheEntry *entry = [MSALAccountSignInStateCacheEntry new];
+        entry.state = state;
+        entry.storedAt = [self currentTime];
+        states[homeAccountId] = entry;
+    }
+}
+
+- (void)removeSignInStatesForHomeAccountId:(NSString *)homeAccountId
+                                  clientId:(NSString *)clientId
+{
+    if (!homeAccountId || !clientId) return;
+    
+    @synchronized (self)
+    {
+        NSString *clientPrefix = [self cacheKeyForClientId:clientId keychainGroup:@""];
+        
+        [self.statesByCacheKey enumerateKeysAndObjectsUsingBlock:^(NSString *cacheKey, NSMutableDictionary *states, __unused BOOL *stop) {
+            if ([cacheKey hasPrefix:clientPrefix]) [states removeObjectForKey:homeAccountId];
+        }];
+    }
+}
+
+- (void)removeAllStates
+{
+    @synchronized (self)
+    {
+        [self.statesByCacheKey removeAllObjects];
+    }
+}
+
+#pragma mark - Private
+
+- (NSString *)cacheKeyForClientId:(NSString *)clientId keychainGroup:(NSString *)keychainGroup
+{
+    return [NSString stringWithFormat:@"%@|%@", clientId, keychainGroup ?: @""];
+}
+
+- (NSTimeInterval)currentTime
+{
+    return [NSProcessInfo processInfo].systemUptime;
+}
+
+@end
@@ -53,6 +53,7 @@
 #import "MSALAccount+Internal.h"
 #import "MSALAccountId+Internal.h"
 #import "MSIDAccountMetadataCacheItem.h"
+#import "MSALMetricsRegistry.h"
 
 @interface MSALAccountsProvider()
 
@@ -365,8 +366,10 @@
         return;
     }
     
+    uint64_t ssoExtensionStartTime = [MSALMetricsRegistry currentTime];
     [ssoExtensionRequest executeRequestWithCompletion:^(NSArray<MSIDAccount *> * _Nullable accounts, BOOL returnBrokerAccountsOnly, NSError * _Nullable error)
     {
+        [[MSALMetricsRegistry sharedRegistry] recordLatencySinceStartTime:ssoExtensionStartTime histogram:MSALMetricsHistogramSsoExtensionQueryLatency];
         [self copyAndClearCurrentSSOExtensionRequest];
         
         if (error)
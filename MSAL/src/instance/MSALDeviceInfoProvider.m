@@ -46,6 +46,7 @@
 #import "MSIDAADAuthority.h"
 #import "MSIDAADTenant.h"
 #import "MSIDAccountIdentifier.h"
+#import "MSALMetricsRegistry.h"
 
 @implementation MSALDeviceInfoProvider
 
@@ -110,8 +111,10 @@
     }
 
     MSID_LOG_WITH_CTX_PII(MSIDLogLevelInfo, requestParameters, @"GetDeviceInfo: Invoking Sso Extension with ssoExtensionRequest: %@", MSID_PII_LOG_MASKABLE(ssoExtensionRequest));
+    uint64_t ssoExtensionStartTime = [MSALMetricsRegistry currentTime];
     [ssoExtensionRequest executeRequestWithCompletion:^(MSIDDeviceInfo * _Nullable deviceInfo, NSError * _Nullable error)
     {
+        [[MSALMetricsRegistry sharedRegistry] recordLatencySinceStartTime:ssoExtensionStartTime histogram:MSALMetricsHistogramSsoExtensionQueryLatency];
         MSID_LOG_WITH_CTX_PII(MSIDLogLevelInfo, requestParameters, @"GetDeviceInfo: Receiving results from Sso Extension with device info: %@, error: %@", MSID_PII_LOG_MASKABLE(deviceInfo), MSID_PII_LOG_MASKABLE(error));
         [self copyAndClearCurrentSSOExtensionRequest];
 
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import "MSALTokenResponseValidator.h"
+#import "MSALAccountSignInStateCache.h"
+#import "MSIDTokenResult.h"
+#import "MSIDAccount.h"
+#import "MSIDAccountIdentifier.h"
+#import "MSIDRequestParameters.h"
+#import "MSALMetricsRegistry.h"
+
+@implementation MSALTokenResponseValidator
+
+- (MSIDTokenResult *)validateAndSaveTokenResponse:(MSIDTokenResponse *)tokenResponse
+                                     oauthFactory:(MSIDOauth2Factory *)factory
+                                       tokenCache:(id<MSIDCacheAccessor>)tokenCache
+                             accountMetadataCache:(MSIDAccountMetadataCacheAccessor *)metadataCache
+                                requestParameters:(MSIDRequestParameters *)parameters
+                                 saveSSOStateOnly:(BOOL)saveSSOStateOnly
+                                            error:(NSError **)error
+{
+    uint64_t startTime = [MSALMetricsRegistry currentTime];
+    MSIDTokenResult *result = [super validateAndSaveTokenResponse:tokenResponse
+                                                     oauthFactory:factory
+                                                       tokenCache:tokenCache
+                                             accountMetadataCache:metadataCache
+                                                requestParameters:parameters
+                                                 saveSSOStateOnly:saveSSOStateOnly
+                                                            error:error];
+    
+    [[MSALMetricsRegistry sharedRegistry] recordLatencySinceStartTime:startTime histogram:MSALMetricsHistogramKeychainWriteLatency];
+    
+    if (result)
+    {
+        // Saving a token response marks the account as signed in in the account metadata cache
+        [[MSALAccountSignInStateCache sharedCache] setSignInState:MSIDAccountMetadataStateSignedIn
+                                                 forHomeAccountId:result.account.accountIdentifier.homeAccountId
+                                                         clientId:parameters.clientId
+                                                    keychainGroup:parameters.keychainAccessGroup];
+    }
+    
+    return result;
+}
+
+@end
@@ -36,4 +36,6 @@ enum MSALNativeAuthInternalError: Error, Equatable {
     case invalidRequest
     case generalError
     case invalidAttributes
+    case deadlineExceeded
+    case cancelled
 }
@@ -33,6 +33,9 @@ final class MSALNativeAuthCacheAccessor: MSALNativeAuthCacheInterface {
     private let externalAccountProvider: MSALExternalAccountHandler = MSALExternalAccountHandler()
     private let validator = MSIDTokenResponseValidator()
 
+    // Serializes account replacements, so two sign ins finishing together can't interleave their removals and writes
+    private static let replaceAccountLock = NSLock()
+
     init(tokenCache: MSIDDefaultTokenCacheAccessor, accountMetadataCache: MSIDAccountMetadataCacheAccessor) {
         self.tokenCacheAccessor = tokenCache
         self.accountMetadataCache = accountMetadataCache
@@ -64,16 +67,60 @@ final class MSALNativeAuthCacheAccessor: MSALNativeAuthCacheInterface {
         configuration: MSIDConfiguration,
         context: MSIDRequestContext) throws -> MSIDTokenResult? {
             let ciamOauth2Provider = getCIAMOauth2Provider(clientId: configuration.clientId)
-            return try? validator.validateAndSave(tokenResponse,
-                                                  oauthFactory: ciamOauth2Provider.msidOauth2Factory,
-                                                  tokenCache: tokenCacheAccessor,
-                                                  accountMetadataCache: accountMetadataCache,
-                                                  requestParameters: getRequestParameters(tokenResponse: tokenResponse,
-                                                                                          configuration: configuration,
-                                                                                          context: context),
-                                                  saveSSOStateOnly: false)
+            let result = try? validator.validateAndSave(tokenResponse,
+                                                        oauthFactory: ciamOauth2Provider.msidOauth2Factory,
+                                                        tokenCache: tokenCacheAccessor,
+                                                        accountMetadataCache: accountMetadataCache,
+                                                        requestParameters: getRequestParameters(tokenResponse: tokenResponse,
+                                                                                                configuration: configuration,
+                                                                                                context: context),
+                                                        saveSSOStateOnly: false)
+            if let homeAccountId = result?.account.accountIdentifier.homeAccountId {
+                // The keychain group isn't known here, so drop the silent path's in-memory state and let it re-read the account metadata written above
+                MSALAccountSignInStateCache.shared().removeSignInStates(forHomeAccountId: homeAccountId,
+                                                                        clientId: configuration.clientId)
+            }
+            return result
+        }
+
+    func replaceAccount(
+        tokenResponse: MSIDTokenResponse,
+        configuration: MSIDConfiguration,
+        context: MSIDRequestContext) throws -> MSIDTokenResult? {
+            Self.replaceAccountLock.lock()
+            defer { Self.replaceAccountLock.unlock() }
+
+            do {
+                try removePreviousAccount(configuration: configuration, context: context)
+            } catch {
+                MSALNativeAuthLogger.logPII(level: .warning,
+                                            context: context,
+                                            format: "Error clearing previous account \(MSALLogMask.maskEUII(error)) (ignoring)")
+            }
+
+            return try validateAndSaveTokensAndAccount(tokenResponse: tokenResponse, configuration: configuration, context: context)
+        }
+
+    // Looks up the previous account directly in the token cache for the known client id.
+    // Unlike `getAllAccounts`, this skips the app metadata and account metadata reads and the external account providers.
+    private func removePreviousAccount(configuration: MSIDConfiguration, context: MSIDRequestContext) throws {
+        let accounts = try tokenCacheAccessor.accounts(withAuthority: nil,
+                                                       clientId: configuration.clientId,
+                                                       familyId: nil,
+                                                       accountIdentifier: nil,
+                                                       accountMetadataCache: nil,
+                                                       signedInAccountsOnly: false,
+                                                       context: context)
+        guard let accountIdentifier = accounts.first?.accountIdentifier else {
+            return
         }
 
+        try clearCache(accountIdentifier: accountIdentifier,
+                       authority: configuration.authority,
+                       clientId: configuration.clientId,
+                       context: context)
+    }
+
     // Here we create the MSIDRequestParameters required by the validateAndSave method
     private func getRequestParameters(
         tokenResponse: MSIDTokenResponse,
@@ -40,6 +40,12 @@ protocol MSALNativeAuthCacheInterface {
         configuration: MSIDConfiguration,
         context: MSIDRequestContext) throws -> MSIDTokenResult?
 
+    /// Removes the account previously signed in with `configuration.clientId`, if any, and saves the tokens and account from `tokenResponse`.
+    func replaceAccount(
+        tokenResponse: MSIDTokenResponse,
+        configuration: MSIDConfiguration,
+        context: MSIDRequestContext) throws -> MSIDTokenResult?
+
     func removeTokens(
         accountIdentifier: MSIDAccountIdentifier,
         authority: MSIDAuthority,
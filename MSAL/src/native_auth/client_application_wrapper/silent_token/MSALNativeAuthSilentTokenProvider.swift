@@ -28,7 +28,7 @@ class MSALNativeAuthSilentTokenProvider: MSALNativeAuthSilentTokenProviding {
     private let application: MSALNativeAuthPublicClientApplication?
 
     init(configuration: MSALNativeAuthPublicClientApplicationConfig) throws {
-        self.application = try? MSALNativeAuthPublicClientApplication(nativeAuthConfiguration: configuration)
+        self.application = try MSALNativeAuthPublicClientApplication(nativeAuthConfiguration: configuration)
     }
 
     func acquireTokenSilent(parameters: MSALSilentTokenParameters,
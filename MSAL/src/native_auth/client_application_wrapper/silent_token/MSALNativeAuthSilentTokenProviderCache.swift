@@ -0,0 +1,96 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/// Keeps silent token providers per effective configuration, so that repeated `getAccessToken` calls reuse one
+/// MSALNativeAuthPublicClientApplication instead of validating the configuration and setting up the token cache every time.
+final class MSALNativeAuthSilentTokenProviderCache {
+
+    struct Key: Hashable {
+        let clientId: String
+        let authority: String
+        let challengeTypes: Int
+        let capabilities: Int
+        let slice: String?
+        let dataCenter: String?
+        let redirectUri: String?
+        let bypassRedirectURIValidation: Bool
+
+        init(configuration: MSALNativeAuthPublicClientApplicationConfig) {
+            clientId = configuration.clientId
+            authority = configuration.authority.url.absoluteString
+            challengeTypes = configuration.challengeTypes.rawValue
+            capabilities = configuration.capabilities.rawValue
+            slice = configuration.sliceConfig?.slice
+            dataCenter = configuration.sliceConfig?.dc
+            redirectUri = configuration.redirectUri
+            bypassRedirectURIValidation = configuration.bypassRedirectURIValidation
+        }
+    }
+
+    private let maxEntries: Int
+    private let lock = NSLock()
+    private var providers: [Key: MSALNativeAuthSilentTokenProviding] = [:]
+    private var insertionOrder: [Key] = []
+
+    init(maxEntries: Int = 8) {
+        self.maxEntries = max(maxEntries, 1)
+    }
+
+    /// Returns the cached provider for `configuration`, or builds one with `makeProvider` and caches it.
+    /// Providers that fail to build aren't cached, so the next call tries again.
+    func provider(
+        for configuration: MSALNativeAuthPublicClientApplicationConfig,
+        makeProvider: () -> MSALNativeAuthSilentTokenProviding?
+    ) -> MSALNativeAuthSilentTokenProviding? {
+        let key = Key(configuration: configuration)
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let provider = providers[key] {
+            return provider
+        }
+
+        guard let provider = makeProvider() else {
+            return nil
+        }
+
+        if insertionOrder.count >= maxEntries {
+            providers[insertionOrder.removeFirst()] = nil
+        }
+
+        providers[key] = provider
+        insertionOrder.append(key)
+        return provider
+    }
+
+    func removeAll() {
+        lock.lock()
+        providers.removeAll()
+        insertionOrder.removeAll()
+        lock.unlock()
+    }
+}
@@ -23,7 +23,19 @@
 // THE SOFTWARE.  
 
 class MSALNativeAuthSilentTokenProviderFactory: MSALNativeAuthSilentTokenProviderBuildable {
+
+    // Shared by all account results, which are created per sign in and per getNativeAuthUserAccount call.
+    static let sharedCache = MSALNativeAuthSilentTokenProviderCache()
+
+    private let cache: MSALNativeAuthSilentTokenProviderCache
+
+    init(cache: MSALNativeAuthSilentTokenProviderCache = sharedCache) {
+        self.cache = cache
+    }
+
     func makeSilentTokenProvider(configuration: MSALNativeAuthPublicClientApplicationConfig) throws -> MSALNativeAuthSilentTokenProviding? {
-        return try? MSALNativeAuthSilentTokenProvider(configuration: configuration)
+        return cache.provider(for: configuration) {
+            try? MSALNativeAuthSilentTokenProvider(configuration: configuration)
+        }
     }
 }
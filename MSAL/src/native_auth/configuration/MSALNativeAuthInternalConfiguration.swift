@@ -39,7 +39,15 @@ struct MSALNativeAuthInternalConfiguration {
     let capabilities: [MSALNativeAuthInternalCapability]?
     let redirectUri: String?
     var sliceConfig: MSALSliceConfig?
-    var requestInterceptor: MSALNativeAuthRequestInterceptor?
+    var requestInterceptor: MSALNativeAuthRequestInterceptor? {
+        didSet {
+            requestHeaderCache = requestInterceptor.map { MSALNativeAuthRequestHeaderCache(interceptor: $0) }
+        }
+    }
+    // Shared by all copies of the configuration, so cached headers outlive a single controller.
+    private(set) var requestHeaderCache: MSALNativeAuthRequestHeaderCache?
+    // Shared by all copies of the configuration, so every controller of the application tracks its flows in one group.
+    let flowTasks = MSALNativeAuthFlowTaskGroup()
 
     init(
         clientId: String,
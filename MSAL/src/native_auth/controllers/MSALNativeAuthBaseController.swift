@@ -28,17 +28,22 @@ class MSALNativeAuthBaseController {
 
     typealias TelemetryInfo = (event: MSIDTelemetryAPIEvent?, context: MSALNativeAuthRequestContext)
     let clientId: String
+    let flowTasks: MSALNativeAuthFlowTaskGroup
 
     init(
-        clientId: String
+        clientId: String,
+        flowTasks: MSALNativeAuthFlowTaskGroup = MSALNativeAuthFlowTaskGroup()
     ) {
         self.clientId = clientId
+        self.flowTasks = flowTasks
     }
 
     func makeAndStartTelemetryEvent(
         id: MSALNativeAuthTelemetryApiId,
         context: MSIDRequestContext
     ) -> MSIDTelemetryAPIEvent? {
+        MSALGlobalConfig.loggerConfig.beginLogCapture(forCorrelationId: context.correlationId())
+
         let event = makeLocalTelemetryApiEvent(
             name: MSID_TELEMETRY_EVENT_API_EVENT,
             telemetryApiId: id,
@@ -55,6 +60,13 @@ class MSALNativeAuthBaseController {
         telemetryApiId: MSALNativeAuthTelemetryApiId,
         context: MSIDRequestContext
     ) -> MSIDTelemetryAPIEvent? {
+        let sampler = MSALTelemetrySampler.shared()
+        guard sampler.shouldSampleApiId(telemetryApiId.rawValue, correlationId: context.correlationId()) else {
+            // Unsampled requests don't build events, only a failure is reported when the request is stopped.
+            sampler.markUnsampledRequest(context.telemetryRequestId(), apiId: telemetryApiId.rawValue)
+            return nil
+        }
+
         let event = MSIDTelemetryAPIEvent(
             name: name,
             context: context
@@ -69,6 +81,10 @@ class MSALNativeAuthBaseController {
 
     func startTelemetryEvent(_ localEvent: MSIDTelemetryAPIEvent?, context: MSIDRequestContext) {
         guard let eventName = localEvent?.property(withName: MSID_TELEMETRY_KEY_EVENT_NAME) else {
+            if localEvent == nil && MSALTelemetrySampler.shared().isUnsampledRequest(context.telemetryRequestId()) {
+                return
+            }
+
             return MSALNativeAuthLogger.log(
                 level: .error,
                 context: context,
@@ -87,7 +103,22 @@ class MSALNativeAuthBaseController {
     }
 
     func stopTelemetryEvent(_ localEvent: MSIDTelemetryAPIEvent?, context: MSIDRequestContext, error: Error? = nil) {
+        MSALGlobalConfig.loggerConfig.endLogCapture(forCorrelationId: context.correlationId(), error: error)
+
         guard let event = localEvent else {
+            var apiId = 0
+            if MSALTelemetrySampler.shared().completeUnsampledRequest(context.telemetryRequestId(), apiId: &apiId) {
+                if let error = error {
+                    MSALTelemetrySampler.shared().dispatchFailureEvent(
+                        forApiId: apiId,
+                        correlationId: context.correlationId(),
+                        clientId: clientId,
+                        error: error
+                    )
+                }
+                return
+            }
+
             return MSALNativeAuthLogger.log(
                 level: .error,
                 context: context,
@@ -153,6 +184,16 @@ class MSALNativeAuthBaseController {
         _ request: MSIDHttpRequest,
         context: MSALNativeAuthRequestContext
     ) async -> Result<T, Error> {
+        // A flow is a chain of dependent requests, so once its deadline has passed there is no point in sending the next one.
+        guard !context.isDeadlineExceeded() else {
+            MSALNativeAuthLogger.log(level: .error, context: context, format: "Request not sent, the deadline of the call has passed")
+            return .failure(MSALNativeAuthInternalError.deadlineExceeded)
+        }
+        guard !Task.isCancelled else {
+            MSALNativeAuthLogger.log(level: .error, context: context, format: "Request not sent, the operation was cancelled")
+            return .failure(MSALNativeAuthInternalError.cancelled)
+        }
+
         return await withCheckedContinuation { continuation in
             request.send { [weak self] result, error in
                 if let error = error {
@@ -0,0 +1,80 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+protocol MSALNativeAuthFlowTaskProviding {
+    var flowTasks: MSALNativeAuthFlowTaskGroup { get }
+}
+
+/// Tracks the tasks started by native auth entry points and state actions of one application, so that in-flight flows can be cancelled together.
+/// The tasks are unstructured `Task`s that the group only keeps track of: they are not children of a Swift `TaskGroup`,
+/// and a cancelled flow stops before its next request and reports an error to its delegate.
+final class MSALNativeAuthFlowTaskGroup {
+
+    private let lock = NSLock()
+    private var tasks: [UUID: Task<Void, Never>] = [:]
+
+    var runningTaskCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return tasks.count
+    }
+
+    @discardableResult
+    func run(_ operation: @escaping () async -> Void) -> Task<Void, Never> {
+        let id = UUID()
+
+        // The lock is held until the task is stored, so a task that finishes right away can't be removed before it's added.
+        lock.lock()
+        let task = Task { [weak self] in
+            await operation()
+            self?.removeTask(id: id)
+        }
+        tasks[id] = task
+        lock.unlock()
+
+        return task
+    }
+
+    /// Calls the delegate callbacks of a flow in a single hop to the main actor.
+    func deliver(_ callbacks: @escaping @MainActor () -> Void) async {
+        await MainActor.run { callbacks() }
+    }
+
+    func cancelAll() {
+        lock.lock()
+        let runningTasks = tasks.values
+        tasks.removeAll()
+        lock.unlock()
+
+        runningTasks.forEach { $0.cancel() }
+    }
+
+    private func removeTask(id: UUID) {
+        lock.lock()
+        tasks[id] = nil
+        lock.unlock()
+    }
+}
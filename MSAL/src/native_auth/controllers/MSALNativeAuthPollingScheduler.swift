@@ -0,0 +1,112 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/// Schedules repeated calls to an endpoint that completes asynchronously on the server, such as `resetpassword/v1.0/poll_completion`.
+///
+/// The first retry happens after a short probe delay, then the delay grows exponentially with jitter up to `maximumDelay`.
+/// A `Retry-After` returned by the server is treated as the minimum wait before the next call.
+/// Polling stops once `timeout` has passed since the first call, or as soon as the current task is cancelled.
+struct MSALNativeAuthPollingScheduler {
+
+    enum PollResult<T> {
+        case completed(T)
+        case pending(retryAfter: TimeInterval?)
+    }
+
+    enum Outcome<T> {
+        case completed(T)
+        case timedOut
+        case cancelled
+    }
+
+    let firstProbeDelay: TimeInterval
+    let maximumDelay: TimeInterval
+    let timeout: TimeInterval
+    let backoffMultiplier: Double
+    let jitterFraction: Double
+
+    private let currentTime: () -> TimeInterval
+    private let sleep: (TimeInterval) async throws -> Void
+    private let random: (ClosedRange<Double>) -> Double
+
+    init(
+        firstProbeDelay: TimeInterval,
+        maximumDelay: TimeInterval,
+        timeout: TimeInterval,
+        backoffMultiplier: Double = 2,
+        jitterFraction: Double = 0.2,
+        currentTime: @escaping () -> TimeInterval = { ProcessInfo.processInfo.systemUptime },
+        sleep: @escaping (TimeInterval) async throws -> Void = { try await Task.sleep(nanoseconds: UInt64($0 * 1_000_000_000)) },
+        random: @escaping (ClosedRange<Double>) -> Double = { Double.random(in: $0) }
+    ) {
+        self.firstProbeDelay = max(firstProbeDelay, 0)
+        self.maximumDelay = max(maximumDelay, self.firstProbeDelay)
+        self.timeout = max(timeout, 0)
+        self.backoffMultiplier = max(backoffMultiplier, 1)
+        self.jitterFraction = min(max(jitterFraction, 0), 1)
+        self.currentTime = currentTime
+        self.sleep = sleep
+        self.random = random
+    }
+
+    func poll<T>(_ operation: () async -> PollResult<T>) async -> Outcome<T> {
+        let deadline = currentTime() + timeout
+        var delay = firstProbeDelay
+
+        while true {
+            guard !Task.isCancelled else { return .cancelled }
+
+            let retryAfter: TimeInterval?
+            switch await operation() {
+            case .completed(let value):
+                return .completed(value)
+            case .pending(let serverRetryAfter):
+                retryAfter = serverRetryAfter
+            }
+
+            guard !Task.isCancelled else { return .cancelled }
+
+            let remaining = deadline - currentTime()
+            guard remaining > 0 else { return .timedOut }
+
+            var wait = delay * random((1 - jitterFraction)...1)
+
+            if let retryAfter {
+                // Polling earlier than the server asked for would only be rejected again.
+                guard retryAfter < remaining else { return .timedOut }
+                wait = max(wait, retryAfter)
+            }
+
+            do {
+                try await sleep(min(wait, remaining))
+            } catch {
+                return .cancelled
+            }
+
+            delay = min(delay * backoffMultiplier, maximumDelay)
+        }
+    }
+}
@@ -40,14 +40,16 @@ class MSALNativeAuthTokenController: MSALNativeAuthBaseController {
         requestProvider: MSALNativeAuthTokenRequestProviding,
         cacheAccessor: MSALNativeAuthCacheInterface,
         factory: MSALNativeAuthResultBuildable,
-        responseValidator: MSALNativeAuthTokenResponseValidating
+        responseValidator: MSALNativeAuthTokenResponseValidating,
+        flowTasks: MSALNativeAuthFlowTaskGroup = MSALNativeAuthFlowTaskGroup()
     ) {
         self.requestProvider = requestProvider
         self.factory = factory
         self.responseValidator = responseValidator
         self.cacheAccessor = cacheAccessor
         super.init(
-            clientId: clientId
+            clientId: clientId,
+            flowTasks: flowTasks
         )
     }
 
@@ -168,15 +170,10 @@ extension MSALNativeAuthTokenController {
         msidConfiguration: MSIDConfiguration
     ) -> MSIDTokenResult? {
         do {
-            // If there is an account existing already in the cache, we remove it
-            try clearAccount(msidConfiguration: msidConfiguration, context: context)
-        } catch {
-            MSALNativeAuthLogger.logPII(level: .warning, context: context, format: "Error clearing account \(MSALLogMask.maskEUII(error)) (ignoring)")
-        }
-        do {
-            let result = try cacheAccessor.validateAndSaveTokensAndAccount(tokenResponse: tokenResponse,
-                                                                           configuration: msidConfiguration,
-                                                                           context: context)
+            // If there is an account existing already in the cache, it is replaced by the new one
+            let result = try cacheAccessor.replaceAccount(tokenResponse: tokenResponse,
+                                                          configuration: msidConfiguration,
+                                                          context: context)
             return result
         } catch {
             MSALNativeAuthLogger.logPII(level: .warning,
@@ -186,30 +183,19 @@ extension MSALNativeAuthTokenController {
         return nil
     }
 
-    private func clearAccount(msidConfiguration: MSIDConfiguration, context: MSIDRequestContext) throws {
-        do {
-            let accounts = try cacheAccessor.getAllAccounts(configuration: msidConfiguration)
-            if let account = accounts.first {
-                if let identifier = MSIDAccountIdentifier(displayableId: account.username, homeAccountId: account.identifier) {
-                    try cacheAccessor.clearCache(accountIdentifier: identifier,
-                                                  authority: msidConfiguration.authority,
-                                                  clientId: msidConfiguration.clientId,
-                                                  context: context)
-                }
-            } else {
-                MSALNativeAuthLogger.log(level: .warning,
-                               context: context,
-                               format: "Error creating MSIDAccountIdentifier out of MSALAccount (ignoring)")
-            }
-        } catch {
-            MSALNativeAuthLogger.log(level: .warning, context: context, format: "Error clearing previous account (ignoring)")
-        }
-    }
-
     private func performTokenRequest(
         _ request: MSIDHttpRequest,
         context: MSIDRequestContext
     ) async -> Result<MSALNativeAuthCIAMTokenResponse, Error> {
+        if let nativeAuthContext = context as? MSALNativeAuthRequestContext, nativeAuthContext.isDeadlineExceeded() {
+            MSALNativeAuthLogger.log(level: .error, context: context, format: "Token request not sent, the deadline of the call has passed")
+            return .failure(MSALNativeAuthInternalError.deadlineExceeded)
+        }
+        guard !Task.isCancelled else {
+            MSALNativeAuthLogger.log(level: .error, context: context, format: "Token request not sent, the operation was cancelled")
+            return .failure(MSALNativeAuthInternalError.cancelled)
+        }
+
         return await withCheckedContinuation { continuation in
             request.send { response, error in
                 if let error = error {
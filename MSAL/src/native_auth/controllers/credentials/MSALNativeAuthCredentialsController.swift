@@ -38,7 +38,8 @@ final class MSALNativeAuthCredentialsController: MSALNativeAuthTokenController,
         requestProvider: MSALNativeAuthTokenRequestProviding,
         cacheAccessor: MSALNativeAuthCacheInterface,
         factory: MSALNativeAuthResultBuildable,
-        responseValidator: MSALNativeAuthTokenResponseValidating
+        responseValidator: MSALNativeAuthTokenResponseValidating,
+        flowTasks: MSALNativeAuthFlowTaskGroup = MSALNativeAuthFlowTaskGroup()
     ) {
         self.cacheAccessor = cacheAccessor
         super.init(
@@ -46,20 +47,29 @@ final class MSALNativeAuthCredentialsController: MSALNativeAuthTokenController,
             requestProvider: requestProvider,
             cacheAccessor: cacheAccessor,
             factory: factory,
-            responseValidator: responseValidator
+            responseValidator: responseValidator,
+            flowTasks: flowTasks
         )
     }
 
     convenience init(config: MSALNativeAuthInternalConfiguration, cacheAccessor: MSALNativeAuthCacheInterface) {
+        self.init(config: config, cacheAccessor: cacheAccessor, requestConfigurator: MSALNativeAuthRequestConfigurator(config: config))
+    }
+
+    convenience init(
+        config: MSALNativeAuthInternalConfiguration,
+        cacheAccessor: MSALNativeAuthCacheInterface,
+        requestConfigurator: MSALNativeAuthRequestConfigurator
+    ) {
         let factory = MSALNativeAuthResultFactory(config: config, cacheAccessor: cacheAccessor)
         self.init(
             clientId: config.clientId,
-            requestProvider: MSALNativeAuthTokenRequestProvider(
-                requestConfigurator: MSALNativeAuthRequestConfigurator(config: config)),
+            requestProvider: MSALNativeAuthTokenRequestProvider(requestConfigurator: requestConfigurator),
             cacheAccessor: cacheAccessor,
             factory: factory,
             responseValidator: MSALNativeAuthTokenResponseValidator(factory: factory,
-                                                                    msidValidator: MSIDTokenResponseValidator())
+                                                                    msidValidator: MSIDTokenResponseValidator()),
+            flowTasks: config.flowTasks
         )
     }
 
@@ -22,6 +22,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+import Foundation
+
 protocol MSALNativeAuthControllerBuildable {
     func makeSignUpController(cacheAccessor: MSALNativeAuthCacheInterface) -> MSALNativeAuthSignUpControlling
     func makeSignInController(cacheAccessor: MSALNativeAuthCacheInterface) -> MSALNativeAuthSignInControlling
@@ -30,30 +32,87 @@ protocol MSALNativeAuthControllerBuildable {
     func makeCredentialsController(cacheAccessor: MSALNativeAuthCacheInterface) -> MSALNativeAuthCredentialsControlling
 }
 
+/// Hands out controllers shared by all flows of one configuration.
+/// Controllers keep no per-flow state, so one instance of each is built per cache accessor and reused by every entry point and state.
 final class MSALNativeAuthControllerFactory: MSALNativeAuthControllerBuildable {
+
+    private enum ControllerKind {
+        case signUp
+        case signIn
+        case jit
+        case resetPassword
+        case credentials
+    }
+
+    private struct Entry {
+        let cacheAccessor: AnyObject
+        let controller: AnyObject
+    }
+
     private let config: MSALNativeAuthInternalConfiguration
+    private let requestConfigurator: MSALNativeAuthRequestConfigurator
+    private let lock = NSLock()
+    private var controllers: [ControllerKind: Entry] = [:]
 
     init(config: MSALNativeAuthInternalConfiguration) {
         self.config = config
+        self.requestConfigurator = MSALNativeAuthRequestConfigurator(config: config)
     }
 
     func makeSignUpController(cacheAccessor: MSALNativeAuthCacheInterface) -> MSALNativeAuthSignUpControlling {
-        return MSALNativeAuthSignUpController(config: config, cacheAccessor: cacheAccessor)
+        let signInController = sharedSignInController(cacheAccessor: cacheAccessor)
+        return cachedController(.signUp, cacheAccessor: cacheAccessor) {
+            MSALNativeAuthSignUpController(config: config, requestConfigurator: requestConfigurator, signInController: signInController)
+        }
     }
 
     func makeSignInController(cacheAccessor: MSALNativeAuthCacheInterface) -> MSALNativeAuthSignInControlling {
-        return MSALNativeAuthSignInController(config: config, cacheAccessor: cacheAccessor)
+        return sharedSignInController(cacheAccessor: cacheAccessor)
     }
 
     func makeJITController(cacheAccessor: MSALNativeAuthCacheInterface) -> MSALNativeAuthJITControlling {
-        return MSALNativeAuthJITController(config: config, cacheAccessor: cacheAccessor)
+        let signInController = sharedSignInController(cacheAccessor: cacheAccessor)
+        return cachedController(.jit, cacheAccessor: cacheAccessor) {
+            MSALNativeAuthJITController(config: config, requestConfigurator: requestConfigurator, signInController: signInController)
+        }
     }
 
     func makeResetPasswordController(cacheAccessor: MSALNativeAuthCacheInterface) -> MSALNativeAuthResetPasswordControlling {
-        return MSALNativeAuthResetPasswordController(config: config, cacheAccessor: cacheAccessor)
+        let signInController = sharedSignInController(cacheAccessor: cacheAccessor)
+        return cachedController(.resetPassword, cacheAccessor: cacheAccessor) {
+            MSALNativeAuthResetPasswordController(config: config, requestConfigurator: requestConfigurator, signInController: signInController)
+        }
     }
 
     func makeCredentialsController(cacheAccessor: MSALNativeAuthCacheInterface) -> MSALNativeAuthCredentialsControlling {
-        return MSALNativeAuthCredentialsController(config: config, cacheAccessor: cacheAccessor)
+        return cachedController(.credentials, cacheAccessor: cacheAccessor) {
+            MSALNativeAuthCredentialsController(config: config, cacheAccessor: cacheAccessor, requestConfigurator: requestConfigurator)
+        }
+    }
+
+    private func sharedSignInController(cacheAccessor: MSALNativeAuthCacheInterface) -> MSALNativeAuthSignInController {
+        return cachedController(.signIn, cacheAccessor: cacheAccessor) {
+            MSALNativeAuthSignInController(config: config, cacheAccessor: cacheAccessor, requestConfigurator: requestConfigurator)
+        }
+    }
+
+    // Returns the controller built for the same cache accessor instance, or builds and keeps a new one.
+    private func cachedController<T: AnyObject>(
+        _ kind: ControllerKind,
+        cacheAccessor: MSALNativeAuthCacheInterface,
+        make: () -> T
+    ) -> T {
+        let accessor = cacheAccessor as AnyObject
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let entry = controllers[kind], entry.cacheAccessor === accessor, let controller = entry.controller as? T {
+            return controller
+        }
+
+        let controller = make()
+        controllers[kind] = Entry(cacheAccessor: accessor, controller: controller)
+        return controller
     }
 }
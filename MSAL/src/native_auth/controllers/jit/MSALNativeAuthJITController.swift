@@ -39,21 +39,39 @@ final class MSALNativeAuthJITController: MSALNativeAuthBaseController, MSALNativ
         clientId: String,
         jitRequestProvider: MSALNativeAuthJITRequestProviding,
         jitResponseValidator: MSALNativeAuthJITResponseValidating,
-        signInController: MSALNativeAuthSignInControlling
+        signInController: MSALNativeAuthSignInControlling,
+        flowTasks: MSALNativeAuthFlowTaskGroup = MSALNativeAuthFlowTaskGroup()
     ) {
         self.jitRequestProvider = jitRequestProvider
         self.jitResponseValidator = jitResponseValidator
         self.signInController = signInController
-        super.init(clientId: clientId)
+        super.init(clientId: clientId, flowTasks: flowTasks)
     }
 
     convenience init(config: MSALNativeAuthInternalConfiguration, cacheAccessor: MSALNativeAuthCacheInterface) {
+        let requestConfigurator = MSALNativeAuthRequestConfigurator(config: config)
+        self.init(
+            config: config,
+            requestConfigurator: requestConfigurator,
+            signInController: MSALNativeAuthSignInController(
+                config: config,
+                cacheAccessor: cacheAccessor,
+                requestConfigurator: requestConfigurator
+            )
+        )
+    }
+
+    convenience init(
+        config: MSALNativeAuthInternalConfiguration,
+        requestConfigurator: MSALNativeAuthRequestConfigurator,
+        signInController: MSALNativeAuthSignInControlling
+    ) {
         self.init(
             clientId: config.clientId,
-            jitRequestProvider: MSALNativeAuthJITRequestProvider(
-                requestConfigurator: MSALNativeAuthRequestConfigurator(config: config)),
+            jitRequestProvider: MSALNativeAuthJITRequestProvider(requestConfigurator: requestConfigurator),
             jitResponseValidator: MSALNativeAuthJITResponseValidator(),
-            signInController: MSALNativeAuthSignInController(config: config, cacheAccessor: cacheAccessor)
+            signInController: signInController,
+            flowTasks: config.flowTasks
         )
     }
 
@@ -24,7 +24,7 @@
 
 import Foundation
 
-protocol MSALNativeAuthJITControlling {
+protocol MSALNativeAuthJITControlling: MSALNativeAuthFlowTaskProviding {
     typealias JITGetJITAuthMethodsControllerResponse = MSALNativeAuthControllerTelemetryWrapper<JITRequestGetAuthMethodsResult>
     typealias JITRequestChallengeControllerResponse = MSALNativeAuthControllerTelemetryWrapper<JITRequestChallengeResult>
     typealias JITSubmitChallengeControllerResponse = MSALNativeAuthControllerTelemetryWrapper<JITSubmitChallengeResult>
@@ -27,34 +27,56 @@
 // swiftlint:disable file_length
 // swiftlint:disable:next type_body_length
 final class MSALNativeAuthResetPasswordController: MSALNativeAuthBaseController, MSALNativeAuthResetPasswordControlling {
-    private let kNumberOfTimesToRetryPollCompletionCall = 5
+    private static let kNumberOfPollIntervalsBeforeTimeout = 5
+    private static let kPollCompletionFirstProbeDelay: TimeInterval = 0.5
+    private static let kMinimumPollCompletionInterval: TimeInterval = 1
 
     private let requestProvider: MSALNativeAuthResetPasswordRequestProviding
     private let responseValidator: MSALNativeAuthResetPasswordResponseValidating
     private let signInController: MSALNativeAuthSignInControlling
+    private let makePollingScheduler: (_ pollInterval: Int) -> MSALNativeAuthPollingScheduler
 
     init(
         config: MSALNativeAuthInternalConfiguration,
         requestProvider: MSALNativeAuthResetPasswordRequestProviding,
         responseValidator: MSALNativeAuthResetPasswordResponseValidating,
-        signInController: MSALNativeAuthSignInControlling
+        signInController: MSALNativeAuthSignInControlling,
+        makePollingScheduler: @escaping (_ pollInterval: Int) -> MSALNativeAuthPollingScheduler = MSALNativeAuthResetPasswordController.pollCompletionScheduler
     ) {
         self.requestProvider = requestProvider
         self.responseValidator = responseValidator
         self.signInController = signInController
+        self.makePollingScheduler = makePollingScheduler
 
-        super.init(clientId: config.clientId)
+        super.init(clientId: config.clientId, flowTasks: config.flowTasks)
     }
 
     convenience init(config: MSALNativeAuthInternalConfiguration, cacheAccessor: MSALNativeAuthCacheInterface) {
+        let requestConfigurator = MSALNativeAuthRequestConfigurator(config: config)
+        self.init(
+            config: config,
+            requestConfigurator: requestConfigurator,
+            signInController: MSALNativeAuthSignInController(
+                config: config,
+                cacheAccessor: cacheAccessor,
+                requestConfigurator: requestConfigurator
+            )
+        )
+    }
+
+    convenience init(
+        config: MSALNativeAuthInternalConfiguration,
+        requestConfigurator: MSALNativeAuthRequestConfigurator,
+        signInController: MSALNativeAuthSignInControlling
+    ) {
         self.init(
             config: config,
             requestProvider: MSALNativeAuthResetPasswordRequestProvider(
-                requestConfigurator: MSALNativeAuthRequestConfigurator(config: config),
+                requestConfigurator: requestConfigurator,
                 telemetryProvider: MSALNativeAuthTelemetryProvider()
             ),
             responseValidator: MSALNativeAuthResetPasswordResponseValidator(),
-            signInController: MSALNativeAuthSignInController(config: config, cacheAccessor: cacheAccessor)
+            signInController: signInController
         )
     }
 
@@ -444,7 +466,6 @@ final class MSALNativeAuthResetPasswordController: MSALNativeAuthBaseController,
                 username: username,
                 continuationToken: newContinuationToken,
                 pollInterval: pollInterval,
-                retriesRemaining: kNumberOfTimesToRetryPollCompletionCall,
                 event: event,
                 context: context
             )
@@ -499,32 +520,75 @@ final class MSALNativeAuthResetPasswordController: MSALNativeAuthBaseController,
 
     // MARK: - Poll Completion Request handling
 
+    /// Polls at most for the time the former fixed schedule took (five server poll intervals),
+    /// but probes early and backs off towards the server interval so a fast completion is noticed sooner.
+    /// The server interval is floored at one second, so a `poll_interval` of 0 still leaves room for several attempts.
+    static func pollCompletionScheduler(pollInterval: Int) -> MSALNativeAuthPollingScheduler {
+        let serverInterval = max(TimeInterval(pollInterval), kMinimumPollCompletionInterval)
+
+        return MSALNativeAuthPollingScheduler(
+            firstProbeDelay: min(kPollCompletionFirstProbeDelay, serverInterval),
+            maximumDelay: serverInterval,
+            timeout: serverInterval * TimeInterval(kNumberOfPollIntervalsBeforeTimeout)
+        )
+    }
+
     private func doPollCompletionLoop(
         username: String,
         continuationToken: String,
         pollInterval: Int,
-        retriesRemaining: Int,
         event: MSIDTelemetryAPIEvent?,
         context: MSALNativeAuthRequestContext
     ) async -> ResetPasswordSubmitPasswordControllerResponse {
-        MSALNativeAuthLogger.log(level: .info, context: context, format: "Performing poll completion request")
+        let scheduler = makePollingScheduler(pollInterval)
 
-        let pollCompletionResponse = await performPollCompletionRequest(
-            continuationToken: continuationToken,
-            context: context
-        )
+        let outcome = await scheduler.poll { () -> MSALNativeAuthPollingScheduler.PollResult<MSALNativeAuthResetPasswordPollCompletionValidatedResponse> in
+            MSALNativeAuthLogger.log(level: .info, context: context, format: "Performing poll completion request")
 
-        MSALNativeAuthLogger.log(level: .info, context: context, format: "Handling poll completion response")
+            let response = await performPollCompletionRequest(
+                continuationToken: continuationToken,
+                context: context
+            )
 
-        return await handlePollCompletionResponse(
-            pollCompletionResponse,
-            username: username,
-            pollInterval: pollInterval,
-            retriesRemaining: retriesRemaining,
-            continuationToken: continuationToken,
-            event: event,
-            context: context
-        )
+            if case .success(.inProgress, _, let retryAfter) = response {
+                MSALNativeAuthLogger.log(level: .info, context: context, format: "Reset password: poll completion in progress")
+                return .pending(retryAfter: retryAfter)
+            } else if case .success(.notStarted, _, let retryAfter) = response {
+                MSALNativeAuthLogger.log(level: .info, context: context, format: "Reset password: poll completion not started")
+                return .pending(retryAfter: retryAfter)
+            }
+
+            return .completed(response)
+        }
+
+        switch outcome {
+        case .completed(let pollCompletionResponse):
+            MSALNativeAuthLogger.log(level: .info, context: context, format: "Handling poll completion response")
+
+            return handlePollCompletionResponse(
+                pollCompletionResponse,
+                username: username,
+                continuationToken: continuationToken,
+                event: event,
+                context: context
+            )
+        case .timedOut:
+            return pollCompletionFailed(message: "Password poll completion did not complete in time", event: event, context: context)
+        case .cancelled:
+            return pollCompletionFailed(message: "Password poll completion was cancelled", event: event, context: context)
+        }
+    }
+
+    private func pollCompletionFailed(
+        message: String,
+        event: MSIDTelemetryAPIEvent?,
+        context: MSALNativeAuthRequestContext
+    ) -> ResetPasswordSubmitPasswordControllerResponse {
+        let error = PasswordRequiredError(type: .generalError, correlationId: context.correlationId())
+        self.stopTelemetryEvent(event, context: context, error: error)
+        MSALNativeAuthLogger.log(level: .error, context: context, format: message)
+
+        return .init(.error(error: error, newState: nil), correlationId: context.correlationId())
     }
 
     private func performPollCompletionRequest(
@@ -557,28 +621,19 @@ final class MSALNativeAuthResetPasswordController: MSALNativeAuthBaseController,
     private func handlePollCompletionResponse(
         _ response: MSALNativeAuthResetPasswordPollCompletionValidatedResponse,
         username: String,
-        pollInterval: Int,
-        retriesRemaining: Int,
         continuationToken: String,
         event: MSIDTelemetryAPIEvent?,
         context: MSALNativeAuthRequestContext
-    ) async -> ResetPasswordSubmitPasswordControllerResponse {
+    ) -> ResetPasswordSubmitPasswordControllerResponse {
         MSALNativeAuthLogger.log(level: .info, context: context, format: "Finished resetpassword/poll_completion")
 
         switch response {
-        case .success(let status, let newContinuationToken):
+        case .success(let status, let newContinuationToken, _):
             switch status {
             case .inProgress,
                  .notStarted:
-
-                return await retryPollCompletion(
-                    continuationToken: continuationToken,
-                    pollInterval: pollInterval,
-                    retriesRemaining: retriesRemaining,
-                    username: username,
-                    event: event,
-                    context: context
-                )
+                // The polling scheduler only hands over finished responses, so this is reached only if that contract changes.
+                return pollCompletionFailed(message: "Password poll completion did not complete in time", event: event, context: context)
             case .succeeded:
                 let signInAfterResetPasswordState = SignInAfterResetPasswordState(
                     controller: signInController,
@@ -648,50 +703,5 @@ final class MSALNativeAuthResetPasswordController: MSALNativeAuthBaseController,
         }
     }
     // swiftlint:enable function_body_length
-
-    private func retryPollCompletion(
-        continuationToken: String,
-        pollInterval: Int,
-        retriesRemaining: Int,
-        username: String,
-        event: MSIDTelemetryAPIEvent?,
-        context: MSALNativeAuthRequestContext
-    ) async -> ResetPasswordSubmitPasswordControllerResponse {
-        guard retriesRemaining > 0 else {
-            let error = PasswordRequiredError(type: .generalError, correlationId: context.correlationId())
-            self.stopTelemetryEvent(event, context: context, error: error)
-            MSALNativeAuthLogger.log(level: .error, context: context, format: "Password poll completion did not complete in time")
-
-            return .init(.error(error: error, newState: nil), correlationId: context.correlationId())
-        }
-
-        MSALNativeAuthLogger.log(
-            level: .info,
-            context: context,
-            format: "Reset password: waiting for \(pollInterval) seconds before retrying"
-        )
-
-        do {
-            try await Task.sleep(nanoseconds: 1_000_000_000 * UInt64(pollInterval))
-        } catch {
-            // Task.sleep can throw a CancellationError if the Task is cancelled.
-            // We don't expect that to ever happen here so we just log it and carry on
-
-            MSALNativeAuthLogger.log(
-                level: .error,
-                context: context,
-                format: "Reset Password: Task.sleep unexpectedly threw an error: \(error). Ignoring"
-            )
-        }
-
-        return await doPollCompletionLoop(
-            username: username,
-            continuationToken: continuationToken,
-            pollInterval: pollInterval,
-            retriesRemaining: retriesRemaining - 1,
-            event: event,
-            context: context
-        )
-    }
 }
 // swiftlint:enable file_length
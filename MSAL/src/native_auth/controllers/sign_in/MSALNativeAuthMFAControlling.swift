@@ -24,7 +24,7 @@
 
 import Foundation
 
-protocol MSALNativeAuthMFAControlling {
+protocol MSALNativeAuthMFAControlling: MSALNativeAuthFlowTaskProviding {
 
     typealias MFARequestChallengeControllerResponse = MSALNativeAuthControllerTelemetryWrapper<MFARequestChallengeResult>
     typealias MFASubmitChallengeControllerResponse = MSALNativeAuthControllerTelemetryWrapper<MFASubmitChallengeResult>
@@ -40,6 +40,8 @@ final class MSALNativeAuthSignInController: MSALNativeAuthTokenController, MSALN
     private let signInRequestProvider: MSALNativeAuthSignInRequestProviding
     private let signInResponseValidator: MSALNativeAuthSignInResponseValidating
     private let nativeAuthConfig: MSALNativeAuthInternalConfiguration
+    private let jitRequestProvider: MSALNativeAuthJITRequestProviding
+    private let jitResponseValidator: MSALNativeAuthJITResponseValidating = MSALNativeAuthJITResponseValidator()
     // MARK: - Init
 
     init(
@@ -50,35 +52,46 @@ final class MSALNativeAuthSignInController: MSALNativeAuthTokenController, MSALN
         factory: MSALNativeAuthResultBuildable,
         signInResponseValidator: MSALNativeAuthSignInResponseValidating,
         tokenResponseValidator: MSALNativeAuthTokenResponseValidating,
-        nativeAuthConfig: MSALNativeAuthInternalConfiguration
+        nativeAuthConfig: MSALNativeAuthInternalConfiguration,
+        jitRequestProvider: MSALNativeAuthJITRequestProviding? = nil
     ) {
         self.signInRequestProvider = signInRequestProvider
         self.signInResponseValidator = signInResponseValidator
         self.nativeAuthConfig = nativeAuthConfig
+        self.jitRequestProvider = jitRequestProvider ?? MSALNativeAuthJITRequestProvider(
+            requestConfigurator: MSALNativeAuthRequestConfigurator(config: nativeAuthConfig))
         super.init(
             clientId: clientId,
             requestProvider: tokenRequestProvider,
             cacheAccessor: cacheAccessor,
             factory: factory,
-            responseValidator: tokenResponseValidator
+            responseValidator: tokenResponseValidator,
+            flowTasks: nativeAuthConfig.flowTasks
         )
     }
 
     convenience init(config: MSALNativeAuthInternalConfiguration, cacheAccessor: MSALNativeAuthCacheInterface) {
+        self.init(config: config, cacheAccessor: cacheAccessor, requestConfigurator: MSALNativeAuthRequestConfigurator(config: config))
+    }
+
+    convenience init(
+        config: MSALNativeAuthInternalConfiguration,
+        cacheAccessor: MSALNativeAuthCacheInterface,
+        requestConfigurator: MSALNativeAuthRequestConfigurator
+    ) {
         let factory = MSALNativeAuthResultFactory(config: config, cacheAccessor: cacheAccessor)
         self.init(
             clientId: config.clientId,
-            signInRequestProvider: MSALNativeAuthSignInRequestProvider(
-                requestConfigurator: MSALNativeAuthRequestConfigurator(config: config)),
-            tokenRequestProvider: MSALNativeAuthTokenRequestProvider(
-                requestConfigurator: MSALNativeAuthRequestConfigurator(config: config)),
+            signInRequestProvider: MSALNativeAuthSignInRequestProvider(requestConfigurator: requestConfigurator),
+            tokenRequestProvider: MSALNativeAuthTokenRequestProvider(requestConfigurator: requestConfigurator),
             cacheAccessor: cacheAccessor,
             factory: factory,
             signInResponseValidator: MSALNativeAuthSignInResponseValidator(),
             tokenResponseValidator: MSALNativeAuthTokenResponseValidator(
                 factory: factory,
                 msidValidator: MSIDTokenResponseValidator()),
-            nativeAuthConfig: config
+            nativeAuthConfig: config,
+            jitRequestProvider: MSALNativeAuthJITRequestProvider(requestConfigurator: requestConfigurator)
         )
     }
 
@@ -1001,11 +1014,14 @@ final class MSALNativeAuthSignInController: MSALNativeAuthTokenController, MSALN
         }
     }
 
+    // The JIT controller keeps a strong reference to this controller, so it's created per flow
+    // from the request provider and validator built once with this controller
     private func createJITController() -> MSALNativeAuthJITController {
         MSALNativeAuthJITController(
             clientId: clientId,
-            jitRequestProvider: MSALNativeAuthJITRequestProvider(requestConfigurator: MSALNativeAuthRequestConfigurator(config: nativeAuthConfig)),
-            jitResponseValidator: MSALNativeAuthJITResponseValidator(),
-            signInController: self)
+            jitRequestProvider: jitRequestProvider,
+            jitResponseValidator: jitResponseValidator,
+            signInController: self,
+            flowTasks: flowTasks)
     }
 }
@@ -24,7 +24,7 @@
 
 import Foundation
 
-protocol MSALNativeAuthSignInControlling {
+protocol MSALNativeAuthSignInControlling: MSALNativeAuthFlowTaskProviding {
 
     typealias SignInControllerResponse = MSALNativeAuthControllerTelemetryWrapper<SignInStartResult>
     typealias SignInAfterPreviousFlowControllerResponse =
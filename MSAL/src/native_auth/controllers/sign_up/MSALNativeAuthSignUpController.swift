@@ -45,18 +45,35 @@ final class MSALNativeAuthSignUpController: MSALNativeAuthBaseController, MSALNa
         self.requestProvider = requestProvider
         self.responseValidator = responseValidator
         self.signInController = signInController
-        super.init(clientId: config.clientId)
+        super.init(clientId: config.clientId, flowTasks: config.flowTasks)
     }
 
     convenience init(config: MSALNativeAuthInternalConfiguration, cacheAccessor: MSALNativeAuthCacheInterface) {
+        let requestConfigurator = MSALNativeAuthRequestConfigurator(config: config)
+        self.init(
+            config: config,
+            requestConfigurator: requestConfigurator,
+            signInController: MSALNativeAuthSignInController(
+                config: config,
+                cacheAccessor: cacheAccessor,
+                requestConfigurator: requestConfigurator
+            )
+        )
+    }
+
+    convenience init(
+        config: MSALNativeAuthInternalConfiguration,
+        requestConfigurator: MSALNativeAuthRequestConfigurator,
+        signInController: MSALNativeAuthSignInControlling
+    ) {
         self.init(
             config: config,
             requestProvider: MSALNativeAuthSignUpRequestProvider(
-                requestConfigurator: MSALNativeAuthRequestConfigurator(config: config),
+                requestConfigurator: requestConfigurator,
                 telemetryProvider: MSALNativeAuthTelemetryProvider()
             ),
             responseValidator: MSALNativeAuthSignUpResponseValidator(),
-            signInController: MSALNativeAuthSignInController(config: config, cacheAccessor: cacheAccessor)
+            signInController: signInController
         )
     }
 
@@ -25,6 +25,34 @@
 @_implementationOnly import MSAL_Private
 
 class MSALNativeAuthLogger: MSALLogging {
+
+    /// Returns true if messages at this level pass the level set in `MSALLoggerConfig`.
+    /// Callers can use it to skip building expensive format arguments.
+    static func isEnabled(level: MSIDLogLevel) -> Bool {
+        return level != .nothing && level.rawValue <= MSIDLogger.shared().level.rawValue
+    }
+
+    /// Lines above the log level are kept for requests whose logs are captured for `captureLogsForFailedRequests`.
+    /// Only this request is affected, the log level used by the rest of the process doesn't change.
+    private static func captureIfNeeded(level: MSIDLogLevel,
+                                        correlationId: UUID?,
+                                        containsPII: Bool,
+                                        format: () -> String,
+                                        _ args: [CVarArg]) {
+        let loggerConfig = MSALGlobalConfig.loggerConfig
+        guard level != .nothing,
+              let correlationId,
+              loggerConfig.isCapturingLogs(forCorrelationId: correlationId),
+              let captureLevel = MSALLogLevel(rawValue: level.rawValue) else {
+            return
+        }
+
+        loggerConfig.captureLog(with: captureLevel,
+                                message: String(format: format(), arguments: args),
+                                containsPII: containsPII,
+                                correlationId: correlationId)
+    }
+
     private static func logCommon(level: MSIDLogLevel,
                                   context: MSIDRequestContext? = nil,
                                   correlationId: UUID? = nil,
@@ -50,15 +78,19 @@ class MSALNativeAuthLogger: MSALLogging {
                     filename: String = #fileID,
                     lineNumber: Int = #line,
                     function: String = #function,
-                    format: String,
+                    format: @autoclosure () -> String,
                     _ args: CVarArg...) {
+        guard isEnabled(level: level) else {
+            captureIfNeeded(level: level, correlationId: context?.correlationId(), containsPII: false, format: format, args)
+            return
+        }
         logCommon(level: level,
                   context: context,
                   containsPII: false,
                   filename: filename,
                   lineNumber: lineNumber,
                   function: function,
-                  format: format,
+                  format: format(),
                   getVaList(args))
     }
 
@@ -67,15 +99,19 @@ class MSALNativeAuthLogger: MSALLogging {
                        filename: String = #fileID,
                        lineNumber: Int = #line,
                        function: String = #function,
-                       format: String,
+                       format: @autoclosure () -> String,
                        _ args: CVarArg...) {
+        guard isEnabled(level: level) else {
+            captureIfNeeded(level: level, correlationId: context?.correlationId(), containsPII: true, format: format, args)
+            return
+        }
         logCommon(level: level,
                   context: context,
                   containsPII: true,
                   filename: filename,
                   lineNumber: lineNumber,
                   function: function,
-                  format: format,
+                  format: format(),
                   getVaList(args))
     }
 
@@ -84,15 +120,19 @@ class MSALNativeAuthLogger: MSALLogging {
                     filename: String = #fileID,
                     lineNumber: Int = #line,
                     function: String = #function,
-                    format: String,
+                    format: @autoclosure () -> String,
                     _ args: CVarArg...) {
+        guard isEnabled(level: level) else {
+            captureIfNeeded(level: level, correlationId: correlationId, containsPII: false, format: format, args)
+            return
+        }
         logCommon(level: level,
                   correlationId: correlationId,
                   containsPII: false,
                   filename: filename,
                   lineNumber: lineNumber,
                   function: function,
-                  format: format,
+                  format: format(),
                   getVaList(args))
     }
 
@@ -101,15 +141,19 @@ class MSALNativeAuthLogger: MSALLogging {
                        filename: String = #fileID,
                        lineNumber: Int = #line,
                        function: String = #function,
-                       format: String,
+                       format: @autoclosure () -> String,
                        _ args: CVarArg...) {
+        guard isEnabled(level: level) else {
+            captureIfNeeded(level: level, correlationId: correlationId, containsPII: true, format: format, args)
+            return
+        }
         logCommon(level: level,
                   correlationId: correlationId,
                   containsPII: true,
                   filename: filename,
                   lineNumber: lineNumber,
                   function: function,
-                  format: format,
+                  format: format(),
                   getVaList(args))
     }
 }
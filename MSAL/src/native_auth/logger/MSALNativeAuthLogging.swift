@@ -31,7 +31,7 @@ protocol MSALLogging {
         filename: String,
         lineNumber: Int,
         function: String,
-        format: String,
+        format: @autoclosure () -> String,
         _ args: CVarArg...)
     static func logPII(
         level: MSIDLogLevel,
@@ -39,7 +39,7 @@ protocol MSALLogging {
         filename: String,
         lineNumber: Int,
         function: String,
-        format: String,
+        format: @autoclosure () -> String,
         _ args: CVarArg...)
     static func log(
         level: MSIDLogLevel,
@@ -47,7 +47,7 @@ protocol MSALLogging {
         filename: String,
         lineNumber: Int,
         function: String,
-        format: String,
+        format: @autoclosure () -> String,
         _ args: CVarArg...)
     static func logPII(
         level: MSIDLogLevel,
@@ -55,6 +55,6 @@ protocol MSALLogging {
         filename: String,
         lineNumber: Int,
         function: String,
-        format: String,
+        format: @autoclosure () -> String,
         _ args: CVarArg...)
 }
@@ -0,0 +1,114 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+@_implementationOnly import MSAL_Private
+
+/// Opens a connection to the authority host on the URL session used by `MSIDHttpRequest`,
+/// so the first native auth request doesn't pay for DNS, TCP and TLS setup.
+/// Calls made while a prewarm is in flight, or shortly after one finished, are ignored.
+final class MSALNativeAuthConnectionPrewarmer {
+
+    // Connections stay in the session's pool for a while after a response, so prewarming more often doesn't help.
+    private static let minimumInterval: TimeInterval = 30
+    private static let requestTimeout: TimeInterval = 10
+    private static let prefetchEndpoints: [MSALNativeAuthEndpoint] = [.signInInitiate, .signUpStart, .resetPasswordStart]
+
+    private let hostUrl: URL?
+    private let prefetchUrls: [URL]
+    private let headerCache: MSALNativeAuthRequestHeaderCache?
+    private let session: () -> URLSession
+    private let currentTime: () -> TimeInterval
+    private let lock = NSLock()
+    private var isPrewarming = false
+    private var lastPrewarmTime: TimeInterval?
+
+    init(
+        config: MSALNativeAuthInternalConfiguration,
+        session: @escaping () -> URLSession = { MSIDURLSessionManager.defaultManager.session },
+        currentTime: @escaping () -> TimeInterval = { ProcessInfo.processInfo.systemUptime }
+    ) {
+        self.prefetchUrls = Self.prefetchEndpoints.compactMap { MSALNativeAuthEndpointUrlTable.makeUrl(endpoint: $0, config: config) }
+        self.hostUrl = Self.makeHostUrl(from: config.authority.url)
+        self.headerCache = config.requestHeaderCache
+        self.session = session
+        self.currentTime = currentTime
+    }
+
+    func prewarm(context: MSIDRequestContext, completion: (() -> Void)? = nil) {
+        guard let hostUrl else {
+            MSALNativeAuthLogger.log(level: .warning, context: context, format: "Prewarm skipped, authority host URL is invalid")
+            completion?()
+            return
+        }
+
+        let now = currentTime()
+
+        lock.lock()
+        if isPrewarming || lastPrewarmTime.map({ now - $0 < Self.minimumInterval }) == true {
+            lock.unlock()
+            MSALNativeAuthLogger.log(level: .verbose, context: context, format: "Prewarm skipped, connection was prewarmed recently")
+            completion?()
+            return
+        }
+        isPrewarming = true
+        lock.unlock()
+
+        MSALNativeAuthLogger.log(level: .verbose, context: context, format: "Prewarming connection to authority host")
+
+        prefetchUrls.forEach { headerCache?.prefetchHeaders(for: $0) }
+
+        var request = URLRequest(url: hostUrl, cachePolicy: .reloadIgnoringLocalCacheData, timeoutInterval: Self.requestTimeout)
+        request.httpMethod = "HEAD"
+
+        let task = session().dataTask(with: request) { [weak self] _, _, error in
+            if let error {
+                MSALNativeAuthLogger.logPII(
+                    level: .warning,
+                    context: context,
+                    format: "Prewarm request failed: \(MSALLogMask.maskPII(error.localizedDescription))"
+                )
+            }
+
+            self?.finishPrewarm()
+            completion?()
+        }
+        task.resume()
+    }
+
+    private func finishPrewarm() {
+        lock.lock()
+        isPrewarming = false
+        lastPrewarmTime = currentTime()
+        lock.unlock()
+    }
+
+    private static func makeHostUrl(from authorityUrl: URL) -> URL? {
+        var components = URLComponents()
+        components.scheme = authorityUrl.scheme
+        components.host = authorityUrl.host
+        components.port = authorityUrl.port
+        components.path = "/"
+        return components.url
+    }
+}
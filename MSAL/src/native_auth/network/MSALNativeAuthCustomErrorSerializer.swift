@@ -29,7 +29,7 @@ import Foundation
 final class MSALNativeAuthCustomErrorSerializer<T: Decodable & Error & MSALNativeAuthResponseCorrelatable>: NSObject, MSIDResponseSerialization {
     func responseObject(for httpResponse: HTTPURLResponse?, data: Data?, context: MSIDRequestContext?) throws -> Any {
         do {
-            var customError = try JSONDecoder().decode(T.self, from: data ?? Data())
+            var customError = try MSALNativeAuthResponseDecoder.decode(T.self, from: data ?? Data())
             customError.correlationId = T.retrieveCorrelationIdFromHeaders(from: httpResponse)
 
             // the successfully constructed "customError" needs to be thrown,
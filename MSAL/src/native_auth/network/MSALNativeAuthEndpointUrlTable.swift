@@ -0,0 +1,60 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/// URLs of all native auth endpoints for one configuration.
+/// The authority and slice configuration don't change once the configuration is created, so the URLs are built once.
+struct MSALNativeAuthEndpointUrlTable {
+    private let urls: [MSALNativeAuthEndpoint: URL]
+
+    init(config: MSALNativeAuthInternalConfiguration) {
+        var urls = [MSALNativeAuthEndpoint: URL](minimumCapacity: MSALNativeAuthEndpoint.allCases.count)
+
+        for endpoint in MSALNativeAuthEndpoint.allCases {
+            urls[endpoint] = Self.makeUrl(endpoint: endpoint, config: config)
+        }
+
+        self.urls = urls
+    }
+
+    func url(for endpoint: MSALNativeAuthEndpoint) throws -> URL {
+        guard let url = urls[endpoint] else {
+            throw MSALNativeAuthInternalError.invalidUrl
+        }
+
+        return url
+    }
+
+    static func makeUrl(endpoint: MSALNativeAuthEndpoint, config: MSALNativeAuthInternalConfiguration) -> URL? {
+        var components = URLComponents(url: config.authority.url, resolvingAgainstBaseURL: true)
+        components?.path += endpoint.rawValue
+
+        if let dataCenter = config.sliceConfig?.dc {
+            components?.queryItems = [URLQueryItem(name: "dc", value: dataCenter)]
+        }
+
+        return components?.url
+    }
+}
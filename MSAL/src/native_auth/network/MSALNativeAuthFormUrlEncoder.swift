@@ -0,0 +1,82 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/// Encodes request parameters as an application/x-www-form-urlencoded body.
+/// Pairs are written in key order straight into one byte buffer, so equal parameters always produce the same body.
+enum MSALNativeAuthFormUrlEncoder {
+
+    private static let hexDigits = Array("0123456789ABCDEF".utf8)
+
+    // ASCII alphanumerics and "*-._" are written as they are, a space becomes "+" and every other byte is percent-encoded.
+    private static let unreservedBytes: [Bool] = {
+        var table = [Bool](repeating: false, count: 256)
+        for byte in "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789*-._".utf8 {
+            table[Int(byte)] = true
+        }
+        return table
+    }()
+
+    static func encode(_ parameters: [AnyHashable: Any]) -> Data {
+        let pairs = parameters
+            .map { (key: ($0.key as? String) ?? "", value: ($0.value as? String) ?? "") }
+            .sorted { $0.key < $1.key }
+
+        // Sized for a body that needs no percent-encoding, which is the common case.
+        var capacity = max(pairs.count - 1, 0)
+        for pair in pairs {
+            capacity += pair.key.utf8.count + pair.value.utf8.count + 1
+        }
+
+        var bytes = [UInt8]()
+        bytes.reserveCapacity(capacity)
+
+        for (index, pair) in pairs.enumerated() {
+            if index > 0 {
+                bytes.append(UInt8(ascii: "&"))
+            }
+
+            append(pair.key, to: &bytes)
+            bytes.append(UInt8(ascii: "="))
+            append(pair.value, to: &bytes)
+        }
+
+        return Data(bytes)
+    }
+
+    private static func append(_ string: String, to bytes: inout [UInt8]) {
+        for byte in string.utf8 {
+            if unreservedBytes[Int(byte)] {
+                bytes.append(byte)
+            } else if byte == UInt8(ascii: " ") {
+                bytes.append(UInt8(ascii: "+"))
+            } else {
+                bytes.append(UInt8(ascii: "%"))
+                bytes.append(hexDigits[Int(byte >> 4)])
+                bytes.append(hexDigits[Int(byte & 0x0F)])
+            }
+        }
+    }
+}
@@ -67,9 +67,13 @@ enum MSALNativeAuthRequestConfiguratorType {
 
 class MSALNativeAuthRequestConfigurator: MSIDAADRequestConfigurator {
     let config: MSALNativeAuthInternalConfiguration
+    private let endpointUrls: MSALNativeAuthEndpointUrlTable
+    private let retryBudget: MSALNativeAuthRetryBudget
 
     init(config: MSALNativeAuthInternalConfiguration) {
         self.config = config
+        self.endpointUrls = MSALNativeAuthEndpointUrlTable(config: config)
+        self.retryBudget = MSALNativeAuthRetryBudget.shared(forHost: config.authority.url.host)
     }
 
     func configure(configuratorType: MSALNativeAuthRequestConfiguratorType,
@@ -300,6 +304,12 @@ class MSALNativeAuthRequestConfigurator: MSIDAADRequestConfigurator {
             currentRequestTelemetry: telemetry,
             context: parameters.context
         )
+        // The per endpoint retry policy replaces the fixed 5xx retries of MSIDAADRequestErrorHandler,
+        // so MSALHTTPConfig.retryCount and retryInterval don't apply to native auth requests.
+        request.retryCounter = 0
+        errorHandler.retryPolicy = MSALNativeAuthRetryPolicy.policy(for: parameters.endpoint)
+        errorHandler.retryBudget = retryBudget
+        retryBudget.recordRequest()
         request.errorHandler = errorHandler
     }
 
@@ -309,7 +319,7 @@ class MSALNativeAuthRequestConfigurator: MSIDAADRequestConfigurator {
         request.parameters = parameters.makeRequestBody(config: config)
 
         do {
-            let endpointUrl = try parameters.makeEndpointUrl(config: config)
+            let endpointUrl = try endpointUrls.url(for: parameters.endpoint)
             request.urlRequest = URLRequest(url: endpointUrl)
             request.urlRequest?.httpMethod = MSALParameterStringForHttpMethod(.POST)
         } catch {
@@ -321,8 +331,8 @@ class MSALNativeAuthRequestConfigurator: MSIDAADRequestConfigurator {
             throw MSALNativeAuthInternalError.invalidRequest
         }
         
-        if let interceptor = config.requestInterceptor {
-            request.requestInterceptor = MSALNativeAuthRequestInterceptorBridge(interceptor: interceptor)
+        if let headerCache = config.requestHeaderCache {
+            request.requestInterceptor = MSALNativeAuthRequestInterceptorBridge(headerCache: headerCache)
         }
         configure(request)
     }
@@ -331,14 +341,14 @@ class MSALNativeAuthRequestConfigurator: MSIDAADRequestConfigurator {
 /// Bridges MSALNativeAuthRequestInterceptor (Swift public protocol) to MSIDHttpRequestInterceptorProtocol (ObjC).
 private final class MSALNativeAuthRequestInterceptorBridge: NSObject, MSIDHttpRequestInterceptorProtocol {
 
-    private let interceptor: MSALNativeAuthRequestInterceptor
+    private let headerCache: MSALNativeAuthRequestHeaderCache
 
-    init(interceptor: MSALNativeAuthRequestInterceptor) {
-        self.interceptor = interceptor
+    init(headerCache: MSALNativeAuthRequestHeaderCache) {
+        self.headerCache = headerCache
     }
 
     func addAdditionalHeaderFields(for requestUrl: URL?, with completionBlock: @escaping MSIDHttpRequestInterceptorAddHeaderCompletionBlock) {
-        interceptor.addAdditionalHeaderFields(requestUrl) { additionalHeaders in
+        headerCache.headers(for: requestUrl) { additionalHeaders in
             completionBlock(additionalHeaders)
         }
     }
@@ -0,0 +1,128 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/// Caches headers returned by ``MSALNativeAuthRequestInterceptor/addCacheableHeaderFields(_:completionBlock:)`` per request URL.
+/// Cached headers are returned right away and refreshed in the background once most of their time to live has passed.
+/// Concurrent requests for a URL without valid headers share one interceptor call.
+final class MSALNativeAuthRequestHeaderCache {
+
+    typealias Completion = ([String: String]?) -> Void
+
+    private struct Entry {
+        let headers: [String: String]?
+        let refreshTime: TimeInterval
+        let expiryTime: TimeInterval
+    }
+
+    // Fraction of the time to live after which cached headers are refreshed in the background.
+    private static let refreshFraction = 0.8
+
+    private let interceptor: MSALNativeAuthRequestInterceptor
+    private let currentTime: () -> TimeInterval
+    private let lock = NSLock()
+    private var entries: [String: Entry] = [:]
+    private var pendingCompletions: [String: [Completion]] = [:]
+
+    init(
+        interceptor: MSALNativeAuthRequestInterceptor,
+        currentTime: @escaping () -> TimeInterval = { ProcessInfo.processInfo.systemUptime }
+    ) {
+        self.interceptor = interceptor
+        self.currentTime = currentTime
+    }
+
+    func headers(for requestUrl: URL?, completion: @escaping Completion) {
+        guard interceptor.addCacheableHeaderFields != nil else {
+            interceptor.addAdditionalHeaderFields(requestUrl) { completion($0) }
+            return
+        }
+
+        let key = requestUrl?.absoluteString ?? ""
+        let now = currentTime()
+
+        lock.lock()
+
+        if let entry = entries[key], now < entry.expiryTime {
+            let shouldRefresh = now >= entry.refreshTime && pendingCompletions[key] == nil
+            if shouldRefresh {
+                pendingCompletions[key] = []
+            }
+            lock.unlock()
+
+            completion(entry.headers)
+
+            if shouldRefresh {
+                fetchHeaders(for: requestUrl, key: key)
+            }
+            return
+        }
+
+        let isFetching = pendingCompletions[key] != nil
+        pendingCompletions[key, default: []].append(completion)
+        lock.unlock()
+
+        if !isFetching {
+            fetchHeaders(for: requestUrl, key: key)
+        }
+    }
+
+    /// Fetches and caches headers for `requestUrl` ahead of the first request.
+    /// Does nothing for interceptors that don't implement `addCacheableHeaderFields`, since their headers can't be reused.
+    func prefetchHeaders(for requestUrl: URL?) {
+        guard interceptor.addCacheableHeaderFields != nil else {
+            return
+        }
+
+        headers(for: requestUrl) { _ in }
+    }
+
+    private func fetchHeaders(for requestUrl: URL?, key: String) {
+        let fetchTime = currentTime()
+
+        interceptor.addCacheableHeaderFields?(requestUrl) { [weak self] headers, timeToLive in
+            self?.storeHeaders(headers, timeToLive: timeToLive, fetchTime: fetchTime, key: key)
+        }
+    }
+
+    private func storeHeaders(_ headers: [String: String]?, timeToLive: TimeInterval, fetchTime: TimeInterval, key: String) {
+        lock.lock()
+
+        if timeToLive > 0 {
+            entries[key] = Entry(
+                headers: headers,
+                refreshTime: fetchTime + timeToLive * Self.refreshFraction,
+                expiryTime: fetchTime + timeToLive
+            )
+        } else {
+            entries[key] = nil
+        }
+
+        let completions = pendingCompletions.removeValue(forKey: key) ?? []
+        lock.unlock()
+
+        completions.forEach { $0(headers) }
+    }
+}
@@ -28,6 +28,21 @@ import Foundation
 
 final class MSALNativeAuthResponseErrorHandler<T: Decodable & Error & MSALNativeAuthResponseCorrelatable>: NSObject, MSIDHttpRequestErrorHandling {
 
+    // Set by the request configurator for the endpoint the request is sent to.
+    var retryPolicy: MSALNativeAuthRetryPolicy = .none
+    var retryBudget: MSALNativeAuthRetryBudget?
+
+    private let scheduleRetry: (TimeInterval, @escaping () -> Void) -> Void
+    private var retriesDone = 0
+
+    init(
+        scheduleRetry: @escaping (TimeInterval, @escaping () -> Void) -> Void = { delay, block in
+            DispatchQueue.global().asyncAfter(deadline: .now() + delay, execute: block)
+        }
+    ) {
+        self.scheduleRetry = scheduleRetry
+    }
+
     // swiftlint:disable:next function_parameter_count
     func handleError(
         _ error: Error?,
@@ -39,6 +54,21 @@ final class MSALNativeAuthResponseErrorHandler<T: Decodable & Error & MSALNative
         context: MSIDRequestContext?,
         completionBlock: MSIDHttpRequestDidCompleteBlock?
     ) {
+        if let httpRequest, let completionBlock, let delay = retryDelay(error: error, httpResponse: httpResponse, context: context) {
+            retriesDone += 1
+            MSALMetricsRegistry.shared().incrementCounter(.nativeAuthHttpRetry)
+            MSALNativeAuthLogger.log(
+                level: .warning,
+                context: context,
+                format: "Retrying request after HTTP status \(httpResponse?.statusCode ?? 0) in \(delay) seconds, retry \(retriesDone) of \(retryPolicy.maxRetries)"
+            )
+
+            scheduleRetry(delay) {
+                httpRequest.send(completionBlock)
+            }
+            return
+        }
+
         MSIDAADRequestErrorHandler().handleError(error,
                                                  httpResponse: httpResponse,
                                                  data: data,
@@ -48,4 +78,28 @@ final class MSALNativeAuthResponseErrorHandler<T: Decodable & Error & MSALNative
                                                  context: context,
                                                  completionBlock: completionBlock)
     }
+
+    private func retryDelay(error: Error?, httpResponse: HTTPURLResponse?, context: MSIDRequestContext?) -> TimeInterval? {
+        let retryAfter = MSALNativeAuthRetryAfterParser.seconds(from: httpResponse?.value(forHTTPHeaderField: "Retry-After"), now: Date())
+        let decision = retryPolicy.decision(
+            statusCode: httpResponse?.statusCode,
+            error: error,
+            retryAfter: retryAfter,
+            retriesDone: retriesDone
+        )
+
+        guard case .retry(let delay) = decision else {
+            return nil
+        }
+
+        if let remainingTime = (context as? MSALNativeAuthRequestContext)?.remainingTime(), delay >= remainingTime {
+            return nil
+        }
+
+        guard retryBudget?.withdrawRetry() ?? true else {
+            return nil
+        }
+
+        return delay
+    }
 }
@@ -0,0 +1,65 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/// Responses that carry the `Retry-After` header value, so callers that poll know when the server expects the next request.
+protocol MSALNativeAuthResponseRetryAfterProviding {
+    var retryAfter: TimeInterval? { get set }
+}
+
+extension MSALNativeAuthResponseRetryAfterProviding {
+
+    mutating func readRetryAfter(from httpResponse: HTTPURLResponse?, now: Date = Date()) {
+        retryAfter = MSALNativeAuthRetryAfterParser.seconds(from: httpResponse?.value(forHTTPHeaderField: "Retry-After"), now: now)
+    }
+}
+
+enum MSALNativeAuthRetryAfterParser {
+
+    private static let httpDateFormatter: DateFormatter = {
+        let formatter = DateFormatter()
+        formatter.locale = Locale(identifier: "en_US_POSIX")
+        formatter.timeZone = TimeZone(identifier: "GMT")
+        formatter.dateFormat = "EEE, dd MMM yyyy HH:mm:ss zzz"
+        return formatter
+    }()
+
+    /// Reads a `Retry-After` value given either as a number of seconds or as an HTTP date, and returns the number of seconds to wait.
+    static func seconds(from headerValue: String?, now: Date) -> TimeInterval? {
+        guard let value = headerValue?.trimmingCharacters(in: .whitespaces), !value.isEmpty else {
+            return nil
+        }
+
+        if let seconds = TimeInterval(value) {
+            return seconds >= 0 ? seconds : nil
+        }
+
+        guard let date = httpDateFormatter.date(from: value) else {
+            return nil
+        }
+
+        return max(date.timeIntervalSince(now), 0)
+    }
+}
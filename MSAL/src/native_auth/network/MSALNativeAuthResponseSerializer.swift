@@ -32,12 +32,15 @@ final class MSALNativeAuthResponseSerializer<T: Decodable & MSALNativeAuthRespon
             throw MSALNativeAuthInternalError.responseSerializationError(headerCorrelationId: T.retrieveCorrelationIdFromHeaders(from: httpResponse))
         }
 
-        let decoder = JSONDecoder()
-        decoder.keyDecodingStrategy = .convertFromSnakeCase
-
         do {
-            var response = try decoder.decode(T.self, from: data)
+            var response = try MSALNativeAuthResponseDecoder.decode(T.self, from: data)
             response.correlationId = T.retrieveCorrelationIdFromHeaders(from: httpResponse)
+
+            if var retryAfterResponse = response as? MSALNativeAuthResponseRetryAfterProviding {
+                retryAfterResponse.readRetryAfter(from: httpResponse)
+                return retryAfterResponse
+            }
+
             return response
         } catch {
             MSALNativeAuthLogger.logPII(level: .error, context: context, format: "ResponseSerializer failed decoding \(MSALLogMask.maskPII(error))")
@@ -0,0 +1,102 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/// Limits retries to a share of the traffic sent to one host, so that a server in trouble doesn't receive a multiple of the usual load.
+///
+/// Every request adds `tokensPerRequest` to the budget and every retry takes one token.
+/// The budget also refills by `tokensPerSecond` so that an app sending few requests can still retry occasionally.
+final class MSALNativeAuthRetryBudget {
+
+    private static let lock = NSLock()
+    private static var budgets: [String: MSALNativeAuthRetryBudget] = [:]
+
+    let capacity: Double
+    let tokensPerRequest: Double
+    let tokensPerSecond: Double
+
+    private let currentTime: () -> TimeInterval
+    private let lock = NSLock()
+    private var tokens: Double
+    private var lastRefillTime: TimeInterval
+
+    init(
+        capacity: Double = 10,
+        tokensPerRequest: Double = 0.2,
+        tokensPerSecond: Double = 0.1,
+        currentTime: @escaping () -> TimeInterval = { ProcessInfo.processInfo.systemUptime }
+    ) {
+        self.capacity = capacity
+        self.tokensPerRequest = tokensPerRequest
+        self.tokensPerSecond = tokensPerSecond
+        self.currentTime = currentTime
+        self.tokens = capacity
+        self.lastRefillTime = currentTime()
+    }
+
+    /// Budget shared by all native auth requests to `host`.
+    static func shared(forHost host: String?) -> MSALNativeAuthRetryBudget {
+        let key = host?.lowercased() ?? ""
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let budget = budgets[key] {
+            return budget
+        }
+
+        let budget = MSALNativeAuthRetryBudget()
+        budgets[key] = budget
+        return budget
+    }
+
+    func recordRequest() {
+        lock.lock()
+        refill()
+        tokens = min(tokens + tokensPerRequest, capacity)
+        lock.unlock()
+    }
+
+    /// Takes one token if available. Returns false when the retry should not be sent.
+    func withdrawRetry() -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+
+        refill()
+
+        guard tokens >= 1 else {
+            return false
+        }
+
+        tokens -= 1
+        return true
+    }
+
+    private func refill() {
+        let now = currentTime()
+        tokens = min(tokens + (now - lastRefillTime) * tokensPerSecond, capacity)
+        lastRefillTime = now
+    }
+}
@@ -0,0 +1,162 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+
+/// Decides whether a failed native auth request is sent again and how long to wait before doing so.
+///
+/// Throttling responses (429 and 503) and failures to reach the server are retried on every endpoint, because the server didn't act on the request.
+/// Other server errors and timeouts are retried only on the start, initiate and introspect endpoints, which are safe to replay.
+/// On any other endpoint the server might already have sent a one-time code, or consumed a code or password submission.
+struct MSALNativeAuthRetryPolicy: Equatable {
+
+    enum Decision: Equatable {
+        case retry(after: TimeInterval)
+        case doNotRetry
+    }
+
+    let maxRetries: Int
+    let baseDelay: TimeInterval
+    let maxDelay: TimeInterval
+    /// Longest `Retry-After` worth waiting for. Longer waits are reported to the caller instead.
+    let maxRetryAfter: TimeInterval
+    let jitterFraction: Double
+    let retriesAmbiguousFailures: Bool
+
+    static let none = MSALNativeAuthRetryPolicy(
+        maxRetries: 0,
+        baseDelay: 0,
+        maxDelay: 0,
+        maxRetryAfter: 0,
+        jitterFraction: 0,
+        retriesAmbiguousFailures: false
+    )
+
+    static let replayable = MSALNativeAuthRetryPolicy(
+        maxRetries: 2,
+        baseDelay: 0.5,
+        maxDelay: 4,
+        maxRetryAfter: 10,
+        jitterFraction: 0.5,
+        retriesAmbiguousFailures: true
+    )
+
+    static let throttlingOnly = MSALNativeAuthRetryPolicy(
+        maxRetries: 2,
+        baseDelay: 0.5,
+        maxDelay: 4,
+        maxRetryAfter: 10,
+        jitterFraction: 0.5,
+        retriesAmbiguousFailures: false
+    )
+
+    private static let throttlingStatusCodes: Set<Int> = [429, 503]
+    private static let ambiguousStatusCodes: Set<Int> = [408, 500, 502, 504]
+    private static let connectionErrorCodes: Set<Int> = [
+        NSURLErrorCannotFindHost,
+        NSURLErrorCannotConnectToHost,
+        NSURLErrorDNSLookupFailed,
+        NSURLErrorNotConnectedToInternet
+    ]
+    private static let ambiguousErrorCodes: Set<Int> = [
+        NSURLErrorTimedOut,
+        NSURLErrorNetworkConnectionLost
+    ]
+
+    static func policy(for endpoint: MSALNativeAuthEndpoint) -> MSALNativeAuthRetryPolicy {
+        switch endpoint {
+        case .signUpChallenge,
+             .signInChallenge,
+             .jitChallenge,
+             .resetPasswordChallenge,
+             .signUpContinue,
+             .jitContinue,
+             .token,
+             .resetPasswordContinue,
+             .resetPasswordSubmit,
+             .resetPasswordComplete:
+            return .throttlingOnly
+        case .resetpasswordPollCompletion:
+            // The poll completion loop already repeats this call on its own schedule.
+            return .none
+        case .signUpStart,
+             .signInInitiate,
+             .signInIntrospect,
+             .jitIntrospect,
+             .resetPasswordStart:
+            return .replayable
+        }
+    }
+
+    /// - Parameters:
+    ///   - statusCode: HTTP status code of the response, or nil when no response was received.
+    ///   - error: Transport error, used when no response was received.
+    ///   - retryAfter: Seconds from the `Retry-After` header, if any.
+    ///   - retriesDone: Number of retries already sent for this request.
+    ///   - random: Source of jitter, returns a value in the given range.
+    func decision(
+        statusCode: Int?,
+        error: Error?,
+        retryAfter: TimeInterval?,
+        retriesDone: Int,
+        random: (ClosedRange<Double>) -> Double = { Double.random(in: $0) }
+    ) -> Decision {
+        guard retriesDone < maxRetries, isRetryable(statusCode: statusCode, error: error) else {
+            return .doNotRetry
+        }
+
+        let exponentialDelay = min(baseDelay * pow(2, Double(retriesDone)), maxDelay)
+        let delay = exponentialDelay * random((1 - jitterFraction)...1)
+
+        guard let statusCode, Self.throttlingStatusCodes.contains(statusCode), let retryAfter else {
+            return .retry(after: delay)
+        }
+
+        guard retryAfter <= maxRetryAfter else {
+            return .doNotRetry
+        }
+
+        return .retry(after: max(delay, retryAfter))
+    }
+
+    private func isRetryable(statusCode: Int?, error: Error?) -> Bool {
+        if let statusCode {
+            if Self.throttlingStatusCodes.contains(statusCode) {
+                return true
+            }
+
+            return retriesAmbiguousFailures && Self.ambiguousStatusCodes.contains(statusCode)
+        }
+
+        guard let error = error as NSError?, error.domain == NSURLErrorDomain else {
+            return false
+        }
+
+        if Self.connectionErrorCodes.contains(error.code) {
+            return true
+        }
+
+        return retriesAmbiguousFailures && Self.ambiguousErrorCodes.contains(error.code)
+    }
+}
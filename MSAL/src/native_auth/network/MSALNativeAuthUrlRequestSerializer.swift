@@ -31,6 +31,9 @@ enum MSALNativeAuthUrlRequestEncoding: String {
 
 final class MSALNativeAuthUrlRequestSerializer: NSObject, MSIDRequestSerialization {
 
+    // URLRequest treats a timeout of 0 or less as the system default, so an expired deadline still needs a positive value.
+    private static let minimumTimeoutInterval: TimeInterval = 0.001
+
     private let context: MSIDRequestContext
     private let encoding: MSALNativeAuthUrlRequestEncoding
 
@@ -46,15 +49,22 @@ final class MSALNativeAuthUrlRequestSerializer: NSObject, MSIDRequestSerializati
     ) -> URLRequest {
 
         var request = request
-        var requestHeaders: [String: String] = [:]
+        var requestHeaders: [String: String]
 
         // Convert entries from `headers` to a dictionary [String: String]
 
-        headers.forEach {
-            if let key = $0.key as? String, let value = $0.value as? String {
-                requestHeaders[key] = value
-            } else {
-                MSALNativeAuthLogger.log(level: .error, context: context, format: "Header serialization failed")
+        if let stringHeaders = headers as? [String: String] {
+            requestHeaders = stringHeaders
+        } else {
+            requestHeaders = [:]
+            requestHeaders.reserveCapacity(headers.count + 1)
+
+            headers.forEach {
+                if let key = $0.key as? String, let value = $0.value as? String {
+                    requestHeaders[key] = value
+                } else {
+                    MSALNativeAuthLogger.log(level: .error, context: context, format: "Header serialization failed")
+                }
             }
         }
 
@@ -74,21 +84,17 @@ final class MSALNativeAuthUrlRequestSerializer: NSObject, MSIDRequestSerializati
                 MSALNativeAuthLogger.log(level: .error, context: context, format: "HTTP body request serialization failed")
             }
         } else {
-            let encodedBody = formUrlEncode(parameters)
-            request.httpBody = encodedBody.data(using: .utf8)
+            request.httpBody = MSALNativeAuthFormUrlEncoder.encode(parameters)
         }
 
         requestHeaders["Content-Type"] = encoding.rawValue
         request.allHTTPHeaderFields = requestHeaders
 
-        return request
-    }
+        // Serialization happens right before every send, retries included, so the timeout reflects the time left at that point.
+        if let remainingTime = (context as? MSALNativeAuthRequestContext)?.remainingTime() {
+            request.timeoutInterval = min(request.timeoutInterval, max(remainingTime, Self.minimumTimeoutInterval))
+        }
 
-    private func formUrlEncode(_ parameters: [AnyHashable: Any]) -> String {
-        parameters.map {
-            let encodedKey = (($0.key as? String) ?? "").msidWWWFormURLEncode() ?? ""
-            let encodedValue = (($0.value as? String) ?? "").msidWWWFormURLEncode() ?? ""
-            return "\(encodedKey)=\(encodedValue)"
-        }.joined(separator: "&")
+        return request
     }
 }
@@ -29,10 +29,30 @@ class MSALNativeAuthRequestContext: MSIDRequestContext {
     private let _correlationId: UUID
     private let _telemetryRequestId: String
     private var _serverCorrelationId: UUID? // TODO: Setting the server correlation id here is wrong. Needs refactoring.
+    // System uptime by which all requests of the public API call must be done, nil when the call has no deadline.
+    private let deadline: TimeInterval?
 
-    init(correlationId: UUID? = nil, telemetryRequestId: String = MSIDTelemetry.sharedInstance().generateRequestId()) {
+    init(
+        correlationId: UUID? = nil,
+        telemetryRequestId: String = MSIDTelemetry.sharedInstance().generateRequestId(),
+        timeoutInterval: TimeInterval = 0
+    ) {
         _correlationId = correlationId ?? UUID()
         _telemetryRequestId = telemetryRequestId
+        deadline = timeoutInterval > 0 ? ProcessInfo.processInfo.systemUptime + timeoutInterval : nil
+    }
+
+    /// Seconds left before the deadline, or nil when the call has no deadline.
+    func remainingTime() -> TimeInterval? {
+        deadline.map { $0 - ProcessInfo.processInfo.systemUptime }
+    }
+
+    func isDeadlineExceeded() -> Bool {
+        guard let remainingTime = remainingTime() else {
+            return false
+        }
+
+        return remainingTime <= 0
     }
 
     func correlationId() -> UUID {
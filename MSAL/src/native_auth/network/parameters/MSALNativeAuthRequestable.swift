@@ -35,14 +35,7 @@ protocol MSALNativeAuthRequestable {
 extension MSALNativeAuthRequestable {
 
     func makeEndpointUrl(config: MSALNativeAuthInternalConfiguration) throws -> URL {
-        var components = URLComponents(url: config.authority.url, resolvingAgainstBaseURL: true)
-        components?.path += endpoint.rawValue
-
-        if let dataCenter = config.sliceConfig?.dc {
-            components?.queryItems = [URLQueryItem(name: "dc", value: dataCenter)]
-        }
-
-        guard let url = components?.url else {
+        guard let url = MSALNativeAuthEndpointUrlTable.makeUrl(endpoint: endpoint, config: config) else {
             throw MSALNativeAuthInternalError.invalidUrl
         }
 
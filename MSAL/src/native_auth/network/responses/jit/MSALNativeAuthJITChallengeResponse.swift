@@ -36,4 +36,16 @@ struct MSALNativeAuthJITChallengeResponse: Decodable, MSALNativeAuthResponseCorr
     let interval: Int?
     let redirectReason: String?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case continuationToken = "continuation_token"
+        case challengeType = "challenge_type"
+        case bindingMethod = "binding_method"
+        case challengeTarget = "challenge_target"
+        case challengeChannel = "challenge_channel"
+        case codeLength = "code_length"
+        case interval
+        case redirectReason = "redirect_reason"
+        case correlationId = "correlation_id"
+    }
 }
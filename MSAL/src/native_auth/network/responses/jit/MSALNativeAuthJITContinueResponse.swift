@@ -31,4 +31,11 @@ struct MSALNativeAuthJITContinueResponse: Decodable, MSALNativeAuthBaseSuccessRe
     let redirectReason: String?
     let challengeType: MSALNativeAuthInternalChallengeType?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case continuationToken = "continuation_token"
+        case redirectReason = "redirect_reason"
+        case challengeType = "challenge_type"
+        case correlationId = "correlation_id"
+    }
 }
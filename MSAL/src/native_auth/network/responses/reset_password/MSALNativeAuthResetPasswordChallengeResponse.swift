@@ -35,4 +35,15 @@ struct MSALNativeAuthResetPasswordChallengeResponse: Decodable, MSALNativeAuthBa
     let continuationToken: String?
     let codeLength: Int?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case challengeType = "challenge_type"
+        case redirectReason = "redirect_reason"
+        case bindingMethod = "binding_method"
+        case challengeTargetLabel = "challenge_target_label"
+        case challengeChannel = "challenge_channel"
+        case continuationToken = "continuation_token"
+        case codeLength = "code_length"
+        case correlationId = "correlation_id"
+    }
 }
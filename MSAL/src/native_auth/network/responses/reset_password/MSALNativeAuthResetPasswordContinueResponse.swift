@@ -32,4 +32,12 @@ struct MSALNativeAuthResetPasswordContinueResponse: Decodable, MSALNativeAuthBas
     let redirectReason: String?
     let challengeType: MSALNativeAuthInternalChallengeType?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case continuationToken = "continuation_token"
+        case expiresIn = "expires_in"
+        case redirectReason = "redirect_reason"
+        case challengeType = "challenge_type"
+        case correlationId = "correlation_id"
+    }
 }
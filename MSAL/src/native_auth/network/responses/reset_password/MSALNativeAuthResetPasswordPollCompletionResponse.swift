@@ -24,7 +24,7 @@
 
 import Foundation
 
-struct MSALNativeAuthResetPasswordPollCompletionResponse: Decodable, MSALNativeAuthBaseSuccessResponse {
+struct MSALNativeAuthResetPasswordPollCompletionResponse: Decodable, MSALNativeAuthBaseSuccessResponse, MSALNativeAuthResponseRetryAfterProviding {
 
     // MARK: - Variables
     let status: MSALNativeAuthResetPasswordPollCompletionStatus?
@@ -33,4 +33,15 @@ struct MSALNativeAuthResetPasswordPollCompletionResponse: Decodable, MSALNativeA
     let redirectReason: String?
     let challengeType: MSALNativeAuthInternalChallengeType?
     var correlationId: UUID?
+    // Read from the response headers, not from the body.
+    var retryAfter: TimeInterval?
+
+    enum CodingKeys: String, CodingKey {
+        case status
+        case continuationToken = "continuation_token"
+        case expiresIn = "expires_in"
+        case redirectReason = "redirect_reason"
+        case challengeType = "challenge_type"
+        case correlationId = "correlation_id"
+    }
 }
@@ -31,4 +31,11 @@ struct MSALNativeAuthResetPasswordStartResponse: Decodable, MSALNativeAuthBaseSu
     let challengeType: MSALNativeAuthInternalChallengeType?
     let redirectReason: String?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case continuationToken = "continuation_token"
+        case challengeType = "challenge_type"
+        case redirectReason = "redirect_reason"
+        case correlationId = "correlation_id"
+    }
 }
@@ -32,4 +32,12 @@ struct MSALNativeAuthResetPasswordSubmitResponse: Decodable, MSALNativeAuthBaseS
     let redirectReason: String?
     let challengeType: MSALNativeAuthInternalChallengeType?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case continuationToken = "continuation_token"
+        case pollInterval = "poll_interval"
+        case redirectReason = "redirect_reason"
+        case challengeType = "challenge_type"
+        case correlationId = "correlation_id"
+    }
 }
@@ -31,6 +31,13 @@ struct MSALNativeAuthInternalAuthenticationMethod: Decodable, Equatable {
     let challengeChannel: String
     let loginHint: String?
 
+    enum CodingKeys: String, CodingKey {
+        case id
+        case challengeType = "challenge_type"
+        case challengeChannel = "challenge_channel"
+        case loginHint = "login_hint"
+    }
+
     func toPublicAuthMethod() -> MSALAuthMethod {
         return MSALAuthMethod(
             id: id,
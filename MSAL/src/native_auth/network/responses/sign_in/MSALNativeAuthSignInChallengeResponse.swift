@@ -36,4 +36,16 @@ struct MSALNativeAuthSignInChallengeResponse: Decodable, MSALNativeAuthBaseSucce
     let codeLength: Int?
     let interval: Int?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case continuationToken = "continuation_token"
+        case challengeType = "challenge_type"
+        case redirectReason = "redirect_reason"
+        case bindingMethod = "binding_method"
+        case challengeTargetLabel = "challenge_target_label"
+        case challengeChannel = "challenge_channel"
+        case codeLength = "code_length"
+        case interval
+        case correlationId = "correlation_id"
+    }
 }
@@ -32,4 +32,12 @@ struct MSALNativeAuthSignInIntrospectResponse: Decodable, MSALNativeAuthBaseSucc
     let challengeType: MSALNativeAuthInternalChallengeType?
     let redirectReason: String?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case continuationToken = "continuation_token"
+        case methods
+        case challengeType = "challenge_type"
+        case redirectReason = "redirect_reason"
+        case correlationId = "correlation_id"
+    }
 }
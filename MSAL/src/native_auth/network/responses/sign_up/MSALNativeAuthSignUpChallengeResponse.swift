@@ -34,4 +34,16 @@ struct MSALNativeAuthSignUpChallengeResponse: Decodable, MSALNativeAuthBaseSucce
     let continuationToken: String?
     let codeLength: Int?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case challengeType = "challenge_type"
+        case redirectReason = "redirect_reason"
+        case bindingMethod = "binding_method"
+        case interval
+        case challengeTargetLabel = "challenge_target_label"
+        case challengeChannel = "challenge_channel"
+        case continuationToken = "continuation_token"
+        case codeLength = "code_length"
+        case correlationId = "correlation_id"
+    }
 }
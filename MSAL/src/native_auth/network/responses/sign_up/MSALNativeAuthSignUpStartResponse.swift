@@ -29,4 +29,11 @@ struct MSALNativeAuthSignUpStartResponse: Decodable, MSALNativeAuthBaseSuccessRe
     let challengeType: MSALNativeAuthInternalChallengeType?
     let redirectReason: String?
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case continuationToken = "continuation_token"
+        case challengeType = "challenge_type"
+        case redirectReason = "redirect_reason"
+        case correlationId = "correlation_id"
+    }
 }
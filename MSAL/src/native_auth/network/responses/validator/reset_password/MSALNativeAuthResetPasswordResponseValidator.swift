@@ -281,7 +281,7 @@ final class MSALNativeAuthResetPasswordResponseValidator: MSALNativeAuthResetPas
             return .unexpectedError(.init(errorDescription: MSALNativeAuthErrorMessage.unexpectedResponseBody))
         }
         // Even if the `continuationToken` is nil, the ResetPassword flow is considered successfully completed
-        return .success(status: status, continuationToken: response.continuationToken)
+        return .success(status: status, continuationToken: response.continuationToken, retryAfter: response.retryAfter)
     }
 
     private func handlePollCompletionError(
@@ -102,7 +102,7 @@ enum MSALNativeAuthResetPasswordSubmitValidatedResponse: Equatable {
 }
 
 enum MSALNativeAuthResetPasswordPollCompletionValidatedResponse: Equatable {
-    case success(status: MSALNativeAuthResetPasswordPollCompletionStatus, continuationToken: String?)
+    case success(status: MSALNativeAuthResetPasswordPollCompletionStatus, continuationToken: String?, retryAfter: TimeInterval? = nil)
     case passwordError(error: MSALNativeAuthResetPasswordPollCompletionResponseError)
     case error(MSALNativeAuthResetPasswordPollCompletionResponseError)
     case redirect(reason: String?)
@@ -30,9 +30,10 @@ extension MSALNativeAuthPublicClientApplication {
         username: String,
         password: String?,
         attributes: [String: Any]?,
-        correlationId: UUID?
+        correlationId: UUID?,
+        timeoutInterval: TimeInterval = 0
     ) async -> MSALNativeAuthSignUpControlling.SignUpStartControllerResponse {
-        let context = MSALNativeAuthRequestContext(correlationId: correlationId)
+        let context = MSALNativeAuthRequestContext(correlationId: correlationId, timeoutInterval: timeoutInterval)
         let correlationId = context.correlationId()
 
         guard inputValidator.isInputValid(username) else {
@@ -59,9 +60,10 @@ extension MSALNativeAuthPublicClientApplication {
         password: String?,
         scopes: [String]?,
         claimsRequestJson: String?,
-        correlationId: UUID?
+        correlationId: UUID?,
+        timeoutInterval: TimeInterval = 0
     ) async -> MSALNativeAuthSignInControlling.SignInControllerResponse {
-        let context = MSALNativeAuthRequestContext(correlationId: correlationId)
+        let context = MSALNativeAuthRequestContext(correlationId: correlationId, timeoutInterval: timeoutInterval)
         let correlationId = context.correlationId()
 
         guard inputValidator.isInputValid(username) else {
@@ -86,9 +88,10 @@ extension MSALNativeAuthPublicClientApplication {
 
     func resetPasswordInternal(
         username: String,
-        correlationId: UUID?
+        correlationId: UUID?,
+        timeoutInterval: TimeInterval = 0
     ) async -> MSALNativeAuthResetPasswordControlling.ResetPasswordStartControllerResponse {
-        let context = MSALNativeAuthRequestContext(correlationId: correlationId)
+        let context = MSALNativeAuthRequestContext(correlationId: correlationId, timeoutInterval: timeoutInterval)
         let correlationId = context.correlationId()
 
         guard inputValidator.isInputValid(username) else {
@@ -50,6 +50,8 @@ public final class MSALNativeAuthPublicClientApplication: MSALPublicClientApplic
 
     let controllerFactory: MSALNativeAuthControllerBuildable
     let inputValidator: MSALNativeAuthInputValidating
+    let connectionPrewarmer: MSALNativeAuthConnectionPrewarmer?
+    let flowTasks: MSALNativeAuthFlowTaskGroup
 
     private var cacheAccessorFactory: MSALNativeAuthCacheAccessorBuildable
     lazy var cacheAccessor: MSALNativeAuthCacheAccessor = {
@@ -78,6 +80,8 @@ public final class MSALNativeAuthPublicClientApplication: MSALPublicClientApplic
         self.controllerFactory = MSALNativeAuthControllerFactory(config: internalConfig)
         self.cacheAccessorFactory = MSALNativeAuthCacheAccessorFactory()
         self.inputValidator = MSALNativeAuthInputValidator()
+        self.connectionPrewarmer = MSALNativeAuthConnectionPrewarmer(config: internalConfig)
+        self.flowTasks = internalConfig.flowTasks
 
         if nativeAuthConfiguration.redirectUri == nil {
             MSALNativeAuthLogger.log(level: .warning, context: nil, format: MSALNativeAuthErrorMessage.redirectUriNotSetWarning)
@@ -137,11 +141,14 @@ public final class MSALNativeAuthPublicClientApplication: MSALPublicClientApplic
         controllerFactory: MSALNativeAuthControllerBuildable,
         cacheAccessorFactory: MSALNativeAuthCacheAccessorBuildable,
         inputValidator: MSALNativeAuthInputValidating,
-        configuration: MSALPublicClientApplicationConfig
+        configuration: MSALPublicClientApplicationConfig,
+        connectionPrewarmer: MSALNativeAuthConnectionPrewarmer? = nil
     ) {
         self.controllerFactory = controllerFactory
         self.cacheAccessorFactory = cacheAccessorFactory
         self.inputValidator = inputValidator
+        self.connectionPrewarmer = connectionPrewarmer
+        self.flowTasks = MSALNativeAuthFlowTaskGroup()
 
         super.init()
     }
@@ -156,29 +163,31 @@ public final class MSALNativeAuthPublicClientApplication: MSALPublicClientApplic
         parameters: MSALNativeAuthSignUpParameters,
         delegate: SignUpStartDelegate
     ) {
-        Task {
+        flowTasks.run { [self] in
             let controllerResponse = await signUpInternal(
                 username: parameters.username,
                 password: parameters.password,
                 attributes: parameters.attributes,
-                correlationId: parameters.correlationId
+                correlationId: parameters.correlationId,
+                timeoutInterval: parameters.timeoutInterval
             )
+            await flowTasks.deliver {
+                let delegateDispatcher = SignUpStartDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            let delegateDispatcher = SignUpStartDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
-
-            switch controllerResponse.result {
-            case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
-                await delegateDispatcher.dispatchSignUpCodeRequired(
-                    newState: newState,
-                    sentTo: sentTo,
-                    channelTargetType: channelTargetType,
-                    codeLength: codeLength,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .attributesInvalid(let attributes):
-                await delegateDispatcher.dispatchSignUpAttributesInvalid(attributeNames: attributes, correlationId: controllerResponse.correlationId)
-            case .error(let error):
-                await delegate.onSignUpStartError(error: error)
+                switch controllerResponse.result {
+                case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
+                    delegateDispatcher.dispatchSignUpCodeRequired(
+                        newState: newState,
+                        sentTo: sentTo,
+                        channelTargetType: channelTargetType,
+                        codeLength: codeLength,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .attributesInvalid(let attributes):
+                    delegateDispatcher.dispatchSignUpAttributesInvalid(attributeNames: attributes, correlationId: controllerResponse.correlationId)
+                case .error(let error):
+                    delegate.onSignUpStartError(error: error)
+                }
             }
         }
     }
@@ -191,41 +200,43 @@ public final class MSALNativeAuthPublicClientApplication: MSALPublicClientApplic
         parameters: MSALNativeAuthSignInParameters,
         delegate: SignInStartDelegate
     ) {
-        Task {
+        flowTasks.run { [self] in
             let claimsRequestJson = parameters.claimsRequest?.jsonString()
             let controllerResponse = await signInInternal(
                 username: parameters.username,
                 password: parameters.password,
                 scopes: parameters.scopes,
                 claimsRequestJson: claimsRequestJson,
-                correlationId: parameters.correlationId
+                correlationId: parameters.correlationId,
+                timeoutInterval: parameters.timeoutInterval
             )
+            await flowTasks.deliver {
+                let delegateDispatcher = SignInStartDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            let delegateDispatcher = SignInStartDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
-
-            switch controllerResponse.result {
-            case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
-                await delegateDispatcher.dispatchSignInCodeRequired(
-                    newState: newState,
-                    sentTo: sentTo,
-                    channelTargetType: channelTargetType,
-                    codeLength: codeLength,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .passwordRequired(let newState):
-                await delegateDispatcher.dispatchSignInPasswordRequired(newState: newState, correlationId: controllerResponse.correlationId)
-            case .completed(let result):
-                await delegateDispatcher.dispatchSignInCompleted(result: result, correlationId: controllerResponse.correlationId)
-            case .error(let error):
-                await delegate.onSignInStartError(error: error)
-            case .awaitingMFA(let authMethods, let newState):
-                await delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
-            case .jitAuthMethodsSelectionRequired(let authMethods, let newState):
-                await delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
+                switch controllerResponse.result {
+                case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
+                    delegateDispatcher.dispatchSignInCodeRequired(
+                        newState: newState,
+                        sentTo: sentTo,
+                        channelTargetType: channelTargetType,
+                        codeLength: codeLength,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .passwordRequired(let newState):
+                    delegateDispatcher.dispatchSignInPasswordRequired(newState: newState, correlationId: controllerResponse.correlationId)
+                case .completed(let result):
+                    delegateDispatcher.dispatchSignInCompleted(result: result, correlationId: controllerResponse.correlationId)
+                case .error(let error):
+                    delegate.onSignInStartError(error: error)
+                case .awaitingMFA(let authMethods, let newState):
+                    delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                case .jitAuthMethodsSelectionRequired(let authMethods, let newState):
+                    delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                }
             }
         }
     }
@@ -238,23 +249,25 @@ public final class MSALNativeAuthPublicClientApplication: MSALPublicClientApplic
         parameters: MSALNativeAuthResetPasswordParameters,
         delegate: ResetPasswordStartDelegate
     ) {
-        Task {
+        flowTasks.run { [self] in
             let controllerResponse = await resetPasswordInternal(username: parameters.username,
-                                                                 correlationId: parameters.correlationId)
-
-            let delegateDispatcher = ResetPasswordStartDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+                                                                 correlationId: parameters.correlationId,
+                                                                 timeoutInterval: parameters.timeoutInterval)
+            await flowTasks.deliver {
+                let delegateDispatcher = ResetPasswordStartDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            switch controllerResponse.result {
-            case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
-                await delegateDispatcher.dispatchResetPasswordCodeRequired(
-                    newState: newState,
-                    sentTo: sentTo,
-                    channelTargetType: channelTargetType,
-                    codeLength: codeLength,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .error(let error):
-                await delegate.onResetPasswordStartError(error: error)
+                switch controllerResponse.result {
+                case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
+                    delegateDispatcher.dispatchResetPasswordCodeRequired(
+                        newState: newState,
+                        sentTo: sentTo,
+                        channelTargetType: channelTargetType,
+                        codeLength: codeLength,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .error(let error):
+                    delegate.onResetPasswordStartError(error: error)
+                }
             }
         }
     }
@@ -268,4 +281,22 @@ public final class MSALNativeAuthPublicClientApplication: MSALPublicClientApplic
 
         return controller.retrieveUserAccountResult(context: context)
     }
+
+    /// Open the connection to the authority host ahead of the first Sign Up, Sign In or Reset Password request.
+    /// Call it early, for example at launch or before showing the sign in screen, so the first request doesn't wait for DNS, TCP and TLS setup.
+    /// The call returns immediately and does nothing if the connection was prewarmed recently.
+    /// - Parameter correlationId: Optional. UUID to correlate this request with the server for debugging.
+    public func prewarm(correlationId: UUID? = nil) {
+        let context = MSALNativeAuthRequestContext(correlationId: correlationId)
+        connectionPrewarmer?.prewarm(context: context)
+    }
+
+    /// Cancel the Sign Up, Sign In and Reset Password operations of this application that are still in progress,
+    /// including the ones started from a state object.
+    /// A cancelled operation sends no further requests, stops polling for the reset password result and calls its error delegate.
+    /// Requests already sent to the server are not recalled. A result that was already applied, such as tokens written to the cache,
+    /// is still passed to the delegate.
+    public func cancelAllFlows() {
+        flowTasks.cancelAll()
+    }
 }
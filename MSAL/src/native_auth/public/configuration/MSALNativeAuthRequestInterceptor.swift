@@ -25,6 +25,7 @@
 import Foundation
 
 public typealias MSALNativeAuthRequestInterceptorAddHeaderCompletionBlock = @convention(block) ([String : String]?) -> Void
+public typealias MSALNativeAuthRequestInterceptorCacheableHeaderCompletionBlock = @convention(block) ([String : String]?, TimeInterval) -> Void
 
 @objc public protocol MSALNativeAuthRequestInterceptor: NSObjectProtocol {
     
@@ -42,5 +43,18 @@ public typealias MSALNativeAuthRequestInterceptorAddHeaderCompletionBlock = @con
     ///   - requestUrl: The URL of the outgoing request. Use this to conditionally apply headers per endpoint.
     ///   - completionBlock: Must be called with a header dictionary, or `nil` if no extra headers are needed.
     func addAdditionalHeaderFields(_ requestUrl: URL?, completionBlock: @escaping MSALNativeAuthRequestInterceptorAddHeaderCompletionBlock)
+
+    /// Optional alternative to ``addAdditionalHeaderFields(_:completionBlock:)`` for headers that stay valid for some time,
+    /// such as attestation or app check tokens. When implemented, it's called instead of ``addAdditionalHeaderFields(_:completionBlock:)``.
+    ///
+    /// MSAL caches the returned headers per request URL for `timeToLive` seconds and asks for new headers in the background
+    /// shortly before they expire, so requests don't wait for the interceptor while cached headers are valid.
+    ///
+    /// - Important: `completionBlock` **must always be called**. Pass a `timeToLive` of `0` for headers that must not be cached.
+    ///
+    /// - Parameters:
+    ///   - requestUrl: The URL of the outgoing request. Use this to conditionally apply headers per endpoint.
+    ///   - completionBlock: Must be called with a header dictionary, or `nil` if no extra headers are needed, and the number of seconds the headers stay valid.
+    @objc optional func addCacheableHeaderFields(_ requestUrl: URL?, completionBlock: @escaping MSALNativeAuthRequestInterceptorCacheableHeaderCompletionBlock)
 }
 
@@ -32,4 +32,9 @@ public class MSALNativeAuthSignInAfterResetPasswordParameters: NSObject {
 
     /// The claims parameter that needs to be sent to the service.
     public var claimsRequest: MSALClaimsRequest?
+
+    /// Maximum time in seconds for all requests sent by this call, which can be several dependent requests.
+    /// Each request times out no later than the time that is left, and no further request is sent once it has run out.
+    /// The default, 0, leaves only the per request timeout of ``MSALHTTPConfig/timeoutIntervalForRequest``.
+    public var timeoutInterval: TimeInterval = 0
 }
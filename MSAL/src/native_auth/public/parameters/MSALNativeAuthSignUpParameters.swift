@@ -38,6 +38,11 @@ public class MSALNativeAuthSignUpParameters: NSObject {
     /// UUID to correlate this request with the server for debugging.
     public var correlationId: UUID?
 
+    /// Maximum time in seconds for all requests sent by this call, which can be several dependent requests.
+    /// Each request times out no later than the time that is left, and no further request is sent once it has run out.
+    /// The default, 0, leaves only the per request timeout of ``MSALHTTPConfig/timeoutIntervalForRequest``.
+    public var timeoutInterval: TimeInterval = 0
+
     public init(username: String) {
         self.username = username
     }
@@ -26,10 +26,10 @@ import Foundation
 
 final class CredentialsDelegateDispatcher: DelegateDispatcher<CredentialsDelegate> {
 
-    func dispatchAccessTokenRetrieveCompleted(result: MSALNativeAuthTokenResult, correlationId: UUID) async {
+    @MainActor func dispatchAccessTokenRetrieveCompleted(result: MSALNativeAuthTokenResult, correlationId: UUID) {
         if let onAccessTokenRetrieveCompleted = delegate.onAccessTokenRetrieveCompleted {
             telemetryUpdate?(.success(()))
-            await onAccessTokenRetrieveCompleted(result)
+            onAccessTokenRetrieveCompleted(result)
         } else {
             let error = RetrieveAccessTokenError(
                 type: .generalError,
@@ -37,7 +37,7 @@ final class CredentialsDelegateDispatcher: DelegateDispatcher<CredentialsDelegat
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onAccessTokenRetrieveError(error: error)
+            delegate.onAccessTokenRetrieveError(error: error)
         }
     }
 }
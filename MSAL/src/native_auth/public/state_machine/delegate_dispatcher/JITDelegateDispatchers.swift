@@ -26,19 +26,19 @@ import Foundation
 
 final class JITRequestChallengeDelegateDispatcher: DelegateDispatcher<RegisterStrongAuthChallengeDelegate> {
 
-    func dispatchVerificationRequired(newState: RegisterStrongAuthVerificationRequiredState,
-                                      sentTo: String,
-                                      channelTargetType: MSALNativeAuthChannelType,
-                                      codeLength: Int,
-                                      correlationId: UUID
-    ) async {
+    @MainActor func dispatchVerificationRequired(newState: RegisterStrongAuthVerificationRequiredState,
+                                                 sentTo: String,
+                                                 channelTargetType: MSALNativeAuthChannelType,
+                                                 codeLength: Int,
+                                                 correlationId: UUID
+    ) {
         if let onRegisterStrongAuthVerificationRequired = delegate.onRegisterStrongAuthVerificationRequired {
             telemetryUpdate?(.success(()))
             let result = MSALNativeAuthRegisterStrongAuthVerificationRequiredResult(newState: newState,
                                                                                     sentTo: sentTo,
                                                                                     channelTargetType: channelTargetType,
                                                                                     codeLength: codeLength)
-            await onRegisterStrongAuthVerificationRequired(result)
+            onRegisterStrongAuthVerificationRequired(result)
         } else {
             let error = RegisterStrongAuthChallengeError(
                 type: .generalError,
@@ -46,38 +46,38 @@ final class JITRequestChallengeDelegateDispatcher: DelegateDispatcher<RegisterSt
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onRegisterStrongAuthChallengeError(error: error, newState: nil)
+            delegate.onRegisterStrongAuthChallengeError(error: error, newState: nil)
         }
     }
 
-    func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) async {
+    @MainActor func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) {
         if let onSignInCompleted = delegate.onSignInCompleted {
             telemetryUpdate?(.success(()))
-            await onSignInCompleted(result)
+            onSignInCompleted(result)
         } else {
             let error = RegisterStrongAuthChallengeError(
                 type: .generalError,
                 message: requiredErrorMessage(for: "onSignInCompleted"),
                 correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onRegisterStrongAuthChallengeError(error: error, newState: nil)
+            delegate.onRegisterStrongAuthChallengeError(error: error, newState: nil)
         }
     }
 }
 
 final class JITSubmitChallengeDelegateDispatcher: DelegateDispatcher<RegisterStrongAuthSubmitChallengeDelegate> {
 
-    func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) async {
+    @MainActor func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) {
         if let onSignInCompleted = delegate.onSignInCompleted {
             telemetryUpdate?(.success(()))
-            await onSignInCompleted(result)
+            onSignInCompleted(result)
         } else {
             let error = RegisterStrongAuthSubmitChallengeError(
                 type: .generalError,
                 message: requiredErrorMessage(for: "onSignInCompleted"),
                 correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onRegisterStrongAuthSubmitChallengeError(error: error, newState: nil)
+            delegate.onRegisterStrongAuthSubmitChallengeError(error: error, newState: nil)
         }
     }
 }
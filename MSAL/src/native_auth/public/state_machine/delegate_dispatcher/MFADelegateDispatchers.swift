@@ -26,15 +26,15 @@ import Foundation
 
 final class MFARequestChallengeDelegateDispatcher: DelegateDispatcher<MFARequestChallengeDelegate> {
 
-    func dispatchVerificationRequired(newState: MFARequiredState,
-                                      sentTo: String,
-                                      channelTargetType: MSALNativeAuthChannelType,
-                                      codeLength: Int,
-                                      correlationId: UUID
-    ) async {
+    @MainActor func dispatchVerificationRequired(newState: MFARequiredState,
+                                                 sentTo: String,
+                                                 channelTargetType: MSALNativeAuthChannelType,
+                                                 codeLength: Int,
+                                                 correlationId: UUID
+    ) {
         if let onVerificationRequired = delegate.onMFARequestChallengeVerificationRequired {
             telemetryUpdate?(.success(()))
-            await onVerificationRequired(
+            onVerificationRequired(
                 newState,
                 sentTo,
                 channelTargetType,
@@ -47,14 +47,14 @@ final class MFARequestChallengeDelegateDispatcher: DelegateDispatcher<MFARequest
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onMFARequestChallengeError(error: error, newState: nil)
+            delegate.onMFARequestChallengeError(error: error, newState: nil)
         }
     }
 
-    func dispatchSelectionRequired(authMethods: [MSALAuthMethod], newState: MFARequiredState, correlationId: UUID) async {
+    @MainActor func dispatchSelectionRequired(authMethods: [MSALAuthMethod], newState: MFARequiredState, correlationId: UUID) {
         if let onSelectionRequired = delegate.onMFARequestChallengeSelectionRequired {
             telemetryUpdate?(.success(()))
-            await onSelectionRequired(authMethods, newState)
+            onSelectionRequired(authMethods, newState)
         } else {
             let error = MFARequestChallengeError(
                 type: .generalError,
@@ -62,17 +62,17 @@ final class MFARequestChallengeDelegateDispatcher: DelegateDispatcher<MFARequest
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onMFARequestChallengeError(error: error, newState: nil)
+            delegate.onMFARequestChallengeError(error: error, newState: nil)
         }
     }
 }
 
 final class MFASubmitChallengeDelegateDispatcher: DelegateDispatcher<MFASubmitChallengeDelegate> {
 
-    func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) async {
+    @MainActor func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) {
         if let onSignInCompleted = delegate.onSignInCompleted {
             telemetryUpdate?(.success(()))
-            await onSignInCompleted(result)
+            onSignInCompleted(result)
         } else {
             let error = MFASubmitChallengeError(
                 type: .generalError,
@@ -80,7 +80,7 @@ final class MFASubmitChallengeDelegateDispatcher: DelegateDispatcher<MFASubmitCh
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onMFASubmitChallengeError(error: error, newState: nil)
+            delegate.onMFASubmitChallengeError(error: error, newState: nil)
         }
     }
 }
@@ -26,16 +26,16 @@ import Foundation
 
 final class ResetPasswordStartDelegateDispatcher: DelegateDispatcher<ResetPasswordStartDelegate> {
 
-    func dispatchResetPasswordCodeRequired(
+    @MainActor func dispatchResetPasswordCodeRequired(
         newState: ResetPasswordCodeRequiredState,
         sentTo: String,
         channelTargetType: MSALNativeAuthChannelType,
         codeLength: Int,
         correlationId: UUID
-    ) async {
+    ) {
         if let onResetPasswordCodeRequired = delegate.onResetPasswordCodeRequired {
             telemetryUpdate?(.success(()))
-            await onResetPasswordCodeRequired(newState, sentTo, channelTargetType, codeLength)
+            onResetPasswordCodeRequired(newState, sentTo, channelTargetType, codeLength)
         } else {
             let error = ResetPasswordStartError(
                 type: .generalError,
@@ -43,54 +43,54 @@ final class ResetPasswordStartDelegateDispatcher: DelegateDispatcher<ResetPasswo
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onResetPasswordStartError(error: error)
+            delegate.onResetPasswordStartError(error: error)
         }
     }
 }
 
 final class ResetPasswordVerifyCodeDelegateDispatcher: DelegateDispatcher<ResetPasswordVerifyCodeDelegate> {
 
-    func dispatchPasswordRequired(newState: ResetPasswordRequiredState, correlationId: UUID) async {
+    @MainActor func dispatchPasswordRequired(newState: ResetPasswordRequiredState, correlationId: UUID) {
         if let onPasswordRequired = delegate.onPasswordRequired {
             telemetryUpdate?(.success(()))
-            await onPasswordRequired(newState)
+            onPasswordRequired(newState)
         } else {
             let error = VerifyCodeError(type: .generalError, message: requiredErrorMessage(for: "onPasswordRequired"), correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onResetPasswordVerifyCodeError(error: error, newState: nil)
+            delegate.onResetPasswordVerifyCodeError(error: error, newState: nil)
         }
     }
 }
 
 final class ResetPasswordResendCodeDelegateDispatcher: DelegateDispatcher<ResetPasswordResendCodeDelegate> {
 
-    func dispatchResetPasswordResendCodeRequired(
+    @MainActor func dispatchResetPasswordResendCodeRequired(
         newState: ResetPasswordCodeRequiredState,
         sentTo: String,
         channelTargetType: MSALNativeAuthChannelType,
         codeLength: Int,
         correlationId: UUID
-    ) async {
+    ) {
         if let onResetPasswordResendCodeRequired = delegate.onResetPasswordResendCodeRequired {
             telemetryUpdate?(.success(()))
-            await onResetPasswordResendCodeRequired(newState, sentTo, channelTargetType, codeLength)
+            onResetPasswordResendCodeRequired(newState, sentTo, channelTargetType, codeLength)
         } else {
             let error = ResendCodeError(
                 type: .generalError,
                 message: requiredErrorMessage(for: "onResetPasswordResendCodeRequired"),
                 correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onResetPasswordResendCodeError(error: error, newState: nil)
+            delegate.onResetPasswordResendCodeError(error: error, newState: nil)
         }
     }
 }
 
 final class ResetPasswordRequiredDelegateDispatcher: DelegateDispatcher<ResetPasswordRequiredDelegate> {
 
-    func dispatchResetPasswordCompleted(newState: SignInAfterResetPasswordState, correlationId: UUID) async {
+    @MainActor func dispatchResetPasswordCompleted(newState: SignInAfterResetPasswordState, correlationId: UUID) {
         if let onResetPasswordCompleted = delegate.onResetPasswordCompleted {
             telemetryUpdate?(.success(()))
-            await onResetPasswordCompleted(newState)
+            onResetPasswordCompleted(newState)
         } else {
             let error = PasswordRequiredError(
                 type: .generalError,
@@ -98,7 +98,7 @@ final class ResetPasswordRequiredDelegateDispatcher: DelegateDispatcher<ResetPas
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onResetPasswordRequiredError(error: error, newState: nil)
+            delegate.onResetPasswordRequiredError(error: error, newState: nil)
         }
     }
 }
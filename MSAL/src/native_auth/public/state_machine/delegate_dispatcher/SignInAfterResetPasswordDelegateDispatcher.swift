@@ -26,24 +26,24 @@ import Foundation
 
 final class SignInAfterResetPasswordDelegateDispatcher: DelegateDispatcher<SignInAfterResetPasswordDelegate> {
 
-    func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) async {
+    @MainActor func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) {
         if let onSignInCompleted = delegate.onSignInCompleted {
             telemetryUpdate?(.success(()))
-            await onSignInCompleted(result)
+            onSignInCompleted(result)
         } else {
             let error = SignInAfterResetPasswordError(
                 type: .generalError,
                 message: requiredErrorMessage(for: "onSignInCompleted"),
                 correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInAfterResetPasswordError(error: error)
+            delegate.onSignInAfterResetPasswordError(error: error)
         }
     }
 
-    func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) async {
+    @MainActor func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) {
         if let onSignInAwaitingMFA = delegate.onSignInAwaitingMFA {
             telemetryUpdate?(.success(()))
-            await onSignInAwaitingMFA(authMethods, newState)
+            onSignInAwaitingMFA(authMethods, newState)
         } else {
             let error = SignInAfterResetPasswordError(
                 type: .generalError,
@@ -51,14 +51,14 @@ final class SignInAfterResetPasswordDelegateDispatcher: DelegateDispatcher<SignI
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInAfterResetPasswordError(error: error)
+            delegate.onSignInAfterResetPasswordError(error: error)
         }
     }
 
-    func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) async {
+    @MainActor func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) {
         if let onSignInJITRequired = delegate.onSignInStrongAuthMethodRegistration {
             telemetryUpdate?(.success(()))
-            await onSignInJITRequired(authMethods, newState)
+            onSignInJITRequired(authMethods, newState)
         } else {
             let error = SignInAfterResetPasswordError(
                 type: .generalError,
@@ -66,7 +66,7 @@ final class SignInAfterResetPasswordDelegateDispatcher: DelegateDispatcher<SignI
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInAfterResetPasswordError(error: error)
+            delegate.onSignInAfterResetPasswordError(error: error)
         }
     }
 }
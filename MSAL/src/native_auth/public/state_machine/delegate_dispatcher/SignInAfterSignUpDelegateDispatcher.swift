@@ -26,24 +26,24 @@ import Foundation
 
 final class SignInAfterSignUpDelegateDispatcher: DelegateDispatcher<SignInAfterSignUpDelegate> {
 
-    func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) async {
+    @MainActor func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) {
         if let onSignInCompleted = delegate.onSignInCompleted {
             telemetryUpdate?(.success(()))
-            await onSignInCompleted(result)
+            onSignInCompleted(result)
         } else {
             let error = SignInAfterSignUpError(
                 type: .generalError,
                 message: requiredErrorMessage(for: "onSignInCompleted"),
                 correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInAfterSignUpError(error: error)
+            delegate.onSignInAfterSignUpError(error: error)
         }
     }
 
-    func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) async {
+    @MainActor func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) {
         if let onSignInAwaitingMFA = delegate.onSignInAwaitingMFA {
             telemetryUpdate?(.success(()))
-            await onSignInAwaitingMFA(authMethods, newState)
+            onSignInAwaitingMFA(authMethods, newState)
         } else {
             let error = SignInAfterSignUpError(
                 type: .generalError,
@@ -51,14 +51,14 @@ final class SignInAfterSignUpDelegateDispatcher: DelegateDispatcher<SignInAfterS
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInAfterSignUpError(error: error)
+            delegate.onSignInAfterSignUpError(error: error)
         }
     }
 
-    func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) async {
+    @MainActor func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) {
         if let onSignInJITRequired = delegate.onSignInStrongAuthMethodRegistration {
             telemetryUpdate?(.success(()))
-            await onSignInJITRequired(authMethods, newState)
+            onSignInJITRequired(authMethods, newState)
         } else {
             let error = SignInAfterSignUpError(
                 type: .generalError,
@@ -66,7 +66,7 @@ final class SignInAfterSignUpDelegateDispatcher: DelegateDispatcher<SignInAfterS
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInAfterSignUpError(error: error)
+            delegate.onSignInAfterSignUpError(error: error)
         }
     }
 }
@@ -26,16 +26,16 @@ import Foundation
 
 final class SignInStartDelegateDispatcher: DelegateDispatcher<SignInStartDelegate> {
 
-    func dispatchSignInCodeRequired(
+    @MainActor func dispatchSignInCodeRequired(
         newState: SignInCodeRequiredState,
         sentTo: String,
         channelTargetType: MSALNativeAuthChannelType,
         codeLength: Int,
         correlationId: UUID
-    ) async {
+    ) {
         if let onSignInCodeRequired = delegate.onSignInCodeRequired {
             telemetryUpdate?(.success(()))
-            await onSignInCodeRequired(newState, sentTo, channelTargetType, codeLength)
+            onSignInCodeRequired(newState, sentTo, channelTargetType, codeLength)
         } else {
             let error = SignInStartError(
                 type: .generalError,
@@ -43,14 +43,14 @@ final class SignInStartDelegateDispatcher: DelegateDispatcher<SignInStartDelegat
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInStartError(error: error)
+            delegate.onSignInStartError(error: error)
         }
     }
 
-    func dispatchSignInPasswordRequired(newState: SignInPasswordRequiredState, correlationId: UUID) async {
+    @MainActor func dispatchSignInPasswordRequired(newState: SignInPasswordRequiredState, correlationId: UUID) {
         if let onSignInPasswordRequired = delegate.onSignInPasswordRequired {
             telemetryUpdate?(.success(()))
-            await onSignInPasswordRequired(newState)
+            onSignInPasswordRequired(newState)
         } else {
             let error = SignInStartError(
                 type: .generalError,
@@ -58,14 +58,14 @@ final class SignInStartDelegateDispatcher: DelegateDispatcher<SignInStartDelegat
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInStartError(error: error)
+            delegate.onSignInStartError(error: error)
         }
     }
 
-    func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) async {
+    @MainActor func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) {
         if let onSignInAwaitingMFA = delegate.onSignInAwaitingMFA {
             telemetryUpdate?(.success(()))
-            await onSignInAwaitingMFA(authMethods, newState)
+            onSignInAwaitingMFA(authMethods, newState)
         } else {
             let error = SignInStartError(
                 type: .generalError,
@@ -73,14 +73,14 @@ final class SignInStartDelegateDispatcher: DelegateDispatcher<SignInStartDelegat
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInStartError(error: error)
+            delegate.onSignInStartError(error: error)
         }
     }
 
-    func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) async {
+    @MainActor func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) {
         if let onSignInJITRequired = delegate.onSignInStrongAuthMethodRegistration {
             telemetryUpdate?(.success(()))
-            await onSignInJITRequired(authMethods, newState)
+            onSignInJITRequired(authMethods, newState)
         } else {
             let error = SignInStartError(
                 type: .generalError,
@@ -88,28 +88,28 @@ final class SignInStartDelegateDispatcher: DelegateDispatcher<SignInStartDelegat
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInStartError(error: error)
+            delegate.onSignInStartError(error: error)
         }
     }
 
-    func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) async {
+    @MainActor func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) {
         if let onSignInCompleted = delegate.onSignInCompleted {
             telemetryUpdate?(.success(()))
-            await onSignInCompleted(result)
+            onSignInCompleted(result)
         } else {
             let error = SignInStartError(type: .generalError, message: requiredErrorMessage(for: "onSignInCompleted"), correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInStartError(error: error)
+            delegate.onSignInStartError(error: error)
         }
     }
 }
 
 final class SignInPasswordRequiredDelegateDispatcher: DelegateDispatcher<SignInPasswordRequiredDelegate> {
 
-    func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) async {
+    @MainActor func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) {
         if let onSignInCompleted = delegate.onSignInCompleted {
             telemetryUpdate?(.success(()))
-            await onSignInCompleted(result)
+            onSignInCompleted(result)
         } else {
             let error = PasswordRequiredError(
                 type: .generalError,
@@ -117,14 +117,14 @@ final class SignInPasswordRequiredDelegateDispatcher: DelegateDispatcher<SignInP
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInPasswordRequiredError(error: error, newState: nil)
+            delegate.onSignInPasswordRequiredError(error: error, newState: nil)
         }
     }
 
-    func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) async {
+    @MainActor func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) {
         if let onSignInAwaitingMFA = delegate.onSignInAwaitingMFA {
             telemetryUpdate?(.success(()))
-            await onSignInAwaitingMFA(authMethods, newState)
+            onSignInAwaitingMFA(authMethods, newState)
         } else {
             let error = PasswordRequiredError(
                 type: .generalError,
@@ -132,14 +132,14 @@ final class SignInPasswordRequiredDelegateDispatcher: DelegateDispatcher<SignInP
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInPasswordRequiredError(error: error, newState: nil)
+            delegate.onSignInPasswordRequiredError(error: error, newState: nil)
         }
     }
 
-    func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) async {
+    @MainActor func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) {
         if let onSignInJITRequired = delegate.onSignInStrongAuthMethodRegistration {
             telemetryUpdate?(.success(()))
-            await onSignInJITRequired(authMethods, newState)
+            onSignInJITRequired(authMethods, newState)
         } else {
             let error = PasswordRequiredError(
                 type: .generalError,
@@ -147,40 +147,40 @@ final class SignInPasswordRequiredDelegateDispatcher: DelegateDispatcher<SignInP
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInPasswordRequiredError(error: error, newState: nil)
+            delegate.onSignInPasswordRequiredError(error: error, newState: nil)
         }
     }
 }
 
 final class SignInResendCodeDelegateDispatcher: DelegateDispatcher<SignInResendCodeDelegate> {
 
-    func dispatchSignInResendCodeCodeRequired(
+    @MainActor func dispatchSignInResendCodeCodeRequired(
         newState: SignInCodeRequiredState,
         sentTo: String,
         channelTargetType: MSALNativeAuthChannelType,
         codeLength: Int,
         correlationId: UUID
-    ) async {
+    ) {
         if let onSignInResendCodeCodeRequired = delegate.onSignInResendCodeCodeRequired {
             telemetryUpdate?(.success(()))
-            await onSignInResendCodeCodeRequired(newState, sentTo, channelTargetType, codeLength)
+            onSignInResendCodeCodeRequired(newState, sentTo, channelTargetType, codeLength)
         } else {
             let error = ResendCodeError(
                 type: .generalError,
                 message: requiredErrorMessage(for: "onSignInResendCodeCodeRequired"),
                 correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInResendCodeError(error: error, newState: nil)
+            delegate.onSignInResendCodeError(error: error, newState: nil)
         }
     }
 }
 
 final class SignInVerifyCodeDelegateDispatcher: DelegateDispatcher<SignInVerifyCodeDelegate> {
 
-    func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) async {
+    @MainActor func dispatchAwaitingMFA(authMethods: [MSALAuthMethod], newState: AwaitingMFAState, correlationId: UUID) {
         if let onSignInAwaitingMFA = delegate.onSignInAwaitingMFA {
             telemetryUpdate?(.success(()))
-            await onSignInAwaitingMFA(authMethods, newState)
+            onSignInAwaitingMFA(authMethods, newState)
         } else {
             let error = VerifyCodeError(
                 type: .generalError,
@@ -188,14 +188,14 @@ final class SignInVerifyCodeDelegateDispatcher: DelegateDispatcher<SignInVerifyC
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInVerifyCodeError(error: error, newState: nil)
+            delegate.onSignInVerifyCodeError(error: error, newState: nil)
         }
     }
 
-    func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) async {
+    @MainActor func dispatchJITRequired(authMethods: [MSALAuthMethod], newState: RegisterStrongAuthState, correlationId: UUID) {
         if let onSignInJITRequired = delegate.onSignInStrongAuthMethodRegistration {
             telemetryUpdate?(.success(()))
-            await onSignInJITRequired(authMethods, newState)
+            onSignInJITRequired(authMethods, newState)
         } else {
             let error = VerifyCodeError(
                 type: .generalError,
@@ -203,18 +203,18 @@ final class SignInVerifyCodeDelegateDispatcher: DelegateDispatcher<SignInVerifyC
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInVerifyCodeError(error: error, newState: nil)
+            delegate.onSignInVerifyCodeError(error: error, newState: nil)
         }
     }
 
-    func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) async {
+    @MainActor func dispatchSignInCompleted(result: MSALNativeAuthUserAccountResult, correlationId: UUID) {
         if let onSignInCompleted = delegate.onSignInCompleted {
             telemetryUpdate?(.success(()))
-            await onSignInCompleted(result)
+            onSignInCompleted(result)
         } else {
             let error = VerifyCodeError(type: .generalError, message: requiredErrorMessage(for: "onSignInCompleted"), correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onSignInVerifyCodeError(error: error, newState: nil)
+            delegate.onSignInVerifyCodeError(error: error, newState: nil)
         }
     }
 }
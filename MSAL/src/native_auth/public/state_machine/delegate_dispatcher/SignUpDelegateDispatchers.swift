@@ -26,16 +26,16 @@ import Foundation
 
 final class SignUpStartDelegateDispatcher: DelegateDispatcher<SignUpStartDelegate> {
 
-    func dispatchSignUpCodeRequired(
+    @MainActor func dispatchSignUpCodeRequired(
         newState: SignUpCodeRequiredState,
         sentTo: String,
         channelTargetType: MSALNativeAuthChannelType,
         codeLength: Int,
         correlationId: UUID
-    ) async {
+    ) {
         if let onSignUpCodeRequired = delegate.onSignUpCodeRequired {
             telemetryUpdate?(.success(()))
-            await onSignUpCodeRequired(newState, sentTo, channelTargetType, codeLength)
+            onSignUpCodeRequired(newState, sentTo, channelTargetType, codeLength)
         } else {
             let error = SignUpStartError(
                 type: .generalError,
@@ -43,14 +43,14 @@ final class SignUpStartDelegateDispatcher: DelegateDispatcher<SignUpStartDelegat
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpStartError(error: error)
+            delegate.onSignUpStartError(error: error)
         }
     }
 
-    func dispatchSignUpAttributesInvalid(attributeNames: [String], correlationId: UUID) async {
+    @MainActor func dispatchSignUpAttributesInvalid(attributeNames: [String], correlationId: UUID) {
         if let onSignUpAttributesInvalid = delegate.onSignUpAttributesInvalid {
             telemetryUpdate?(.success(()))
-            await onSignUpAttributesInvalid(attributeNames)
+            onSignUpAttributesInvalid(attributeNames)
         } else {
             let error = SignUpStartError(
                 type: .generalError,
@@ -58,21 +58,21 @@ final class SignUpStartDelegateDispatcher: DelegateDispatcher<SignUpStartDelegat
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpStartError(error: error)
+            delegate.onSignUpStartError(error: error)
         }
     }
 }
 
 final class SignUpVerifyCodeDelegateDispatcher: DelegateDispatcher<SignUpVerifyCodeDelegate> {
 
-    func dispatchSignUpAttributesRequired(
+    @MainActor func dispatchSignUpAttributesRequired(
         attributes: [MSALNativeAuthRequiredAttribute],
         newState: SignUpAttributesRequiredState,
         correlationId: UUID
-    ) async {
+    ) {
         if let onSignUpAttributesRequired = delegate.onSignUpAttributesRequired {
             telemetryUpdate?(.success(()))
-            await onSignUpAttributesRequired(attributes, newState)
+            onSignUpAttributesRequired(attributes, newState)
         } else {
             let error = VerifyCodeError(
                 type: .generalError,
@@ -80,14 +80,14 @@ final class SignUpVerifyCodeDelegateDispatcher: DelegateDispatcher<SignUpVerifyC
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpVerifyCodeError(error: error, newState: nil)
+            delegate.onSignUpVerifyCodeError(error: error, newState: nil)
         }
     }
 
-    func dispatchSignUpPasswordRequired(newState: SignUpPasswordRequiredState, correlationId: UUID) async {
+    @MainActor func dispatchSignUpPasswordRequired(newState: SignUpPasswordRequiredState, correlationId: UUID) {
         if let onSignUpPasswordRequired = delegate.onSignUpPasswordRequired {
             telemetryUpdate?(.success(()))
-            await onSignUpPasswordRequired(newState)
+            onSignUpPasswordRequired(newState)
         } else {
             let error = VerifyCodeError(
                 type: .generalError,
@@ -95,14 +95,14 @@ final class SignUpVerifyCodeDelegateDispatcher: DelegateDispatcher<SignUpVerifyC
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpVerifyCodeError(error: error, newState: nil)
+            delegate.onSignUpVerifyCodeError(error: error, newState: nil)
         }
     }
 
-    func dispatchSignUpCompleted(newState: SignInAfterSignUpState, correlationId: UUID) async {
+    @MainActor func dispatchSignUpCompleted(newState: SignInAfterSignUpState, correlationId: UUID) {
         if let onSignUpCompleted = delegate.onSignUpCompleted {
             telemetryUpdate?(.success(()))
-            await onSignUpCompleted(newState)
+            onSignUpCompleted(newState)
         } else {
             let error = VerifyCodeError(
                 type: .generalError,
@@ -110,44 +110,44 @@ final class SignUpVerifyCodeDelegateDispatcher: DelegateDispatcher<SignUpVerifyC
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpVerifyCodeError(error: error, newState: nil)
+            delegate.onSignUpVerifyCodeError(error: error, newState: nil)
         }
     }
 }
 
 final class SignUpResendCodeDelegateDispatcher: DelegateDispatcher<SignUpResendCodeDelegate> {
 
-    func dispatchSignUpResendCodeCodeRequired(
+    @MainActor func dispatchSignUpResendCodeCodeRequired(
         newState: SignUpCodeRequiredState,
         sentTo: String,
         channelTargetType: MSALNativeAuthChannelType,
         codeLength: Int,
         correlationId: UUID
-    ) async {
+    ) {
         if let onSignUpResendCodeCodeRequired = delegate.onSignUpResendCodeCodeRequired {
             telemetryUpdate?(.success(()))
-            await onSignUpResendCodeCodeRequired(newState, sentTo, channelTargetType, codeLength)
+            onSignUpResendCodeCodeRequired(newState, sentTo, channelTargetType, codeLength)
         } else {
             let error = ResendCodeError(
                 type: .generalError,
                 message: requiredErrorMessage(for: "onSignUpResendCodeCodeRequired"),
                 correlationId: correlationId)
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpResendCodeError(error: error, newState: nil)
+            delegate.onSignUpResendCodeError(error: error, newState: nil)
         }
     }
 }
 
 final class SignUpPasswordRequiredDelegateDispatcher: DelegateDispatcher<SignUpPasswordRequiredDelegate> {
 
-    func dispatchSignUpAttributesRequired(
+    @MainActor func dispatchSignUpAttributesRequired(
         attributes: [MSALNativeAuthRequiredAttribute],
         newState: SignUpAttributesRequiredState,
         correlationId: UUID
-    ) async {
+    ) {
         if let onSignUpAttributesRequired = delegate.onSignUpAttributesRequired {
             telemetryUpdate?(.success(()))
-            await onSignUpAttributesRequired(attributes, newState)
+            onSignUpAttributesRequired(attributes, newState)
         } else {
             let error = PasswordRequiredError(
                 type: .generalError,
@@ -155,14 +155,14 @@ final class SignUpPasswordRequiredDelegateDispatcher: DelegateDispatcher<SignUpP
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpPasswordRequiredError(error: error, newState: nil)
+            delegate.onSignUpPasswordRequiredError(error: error, newState: nil)
         }
     }
 
-    func dispatchSignUpCompleted(newState: SignInAfterSignUpState, correlationId: UUID) async {
+    @MainActor func dispatchSignUpCompleted(newState: SignInAfterSignUpState, correlationId: UUID) {
         if let onSignUpCompleted = delegate.onSignUpCompleted {
             telemetryUpdate?(.success(()))
-            await onSignUpCompleted(newState)
+            onSignUpCompleted(newState)
         } else {
             let error = PasswordRequiredError(
                 type: .generalError,
@@ -170,21 +170,21 @@ final class SignUpPasswordRequiredDelegateDispatcher: DelegateDispatcher<SignUpP
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpPasswordRequiredError(error: error, newState: nil)
+            delegate.onSignUpPasswordRequiredError(error: error, newState: nil)
         }
     }
 }
 
 final class SignUpAttributesRequiredDelegateDispatcher: DelegateDispatcher<SignUpAttributesRequiredDelegate> {
 
-    func dispatchSignUpAttributesRequired(
+    @MainActor func dispatchSignUpAttributesRequired(
         attributes: [MSALNativeAuthRequiredAttribute],
         newState: SignUpAttributesRequiredState,
         correlationId: UUID
-    ) async {
+    ) {
         if let onSignUpAttributesRequired = delegate.onSignUpAttributesRequired {
             telemetryUpdate?(.success(()))
-            await onSignUpAttributesRequired(attributes, newState)
+            onSignUpAttributesRequired(attributes, newState)
         } else {
             let error = AttributesRequiredError(
                 type: .generalError,
@@ -192,14 +192,14 @@ final class SignUpAttributesRequiredDelegateDispatcher: DelegateDispatcher<SignU
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpAttributesRequiredError(error: error)
+            delegate.onSignUpAttributesRequiredError(error: error)
         }
     }
 
-    func dispatchSignUpAttributesInvalid(attributeNames: [String], newState: SignUpAttributesRequiredState, correlationId: UUID) async {
+    @MainActor func dispatchSignUpAttributesInvalid(attributeNames: [String], newState: SignUpAttributesRequiredState, correlationId: UUID) {
         if let onSignUpAttributesInvalid = delegate.onSignUpAttributesInvalid {
             telemetryUpdate?(.success(()))
-            await onSignUpAttributesInvalid(attributeNames, newState)
+            onSignUpAttributesInvalid(attributeNames, newState)
         } else {
             let error = AttributesRequiredError(
                 type: .generalError,
@@ -207,14 +207,14 @@ final class SignUpAttributesRequiredDelegateDispatcher: DelegateDispatcher<SignU
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpAttributesRequiredError(error: error)
+            delegate.onSignUpAttributesRequiredError(error: error)
         }
     }
 
-    func dispatchSignUpCompleted(newState: SignInAfterSignUpState, correlationId: UUID) async {
+    @MainActor func dispatchSignUpCompleted(newState: SignInAfterSignUpState, correlationId: UUID) {
         if let onSignUpCompleted = delegate.onSignUpCompleted {
             telemetryUpdate?(.success(()))
-            await onSignUpCompleted(newState)
+            onSignUpCompleted(newState)
         } else {
             let error = AttributesRequiredError(
                 type: .generalError,
@@ -222,7 +222,7 @@ final class SignUpAttributesRequiredDelegateDispatcher: DelegateDispatcher<SignU
                 correlationId: correlationId
             )
             telemetryUpdate?(.failure(error))
-            await delegate.onSignUpAttributesRequiredError(error: error)
+            delegate.onSignUpAttributesRequiredError(error: error)
         }
     }
 }
@@ -71,7 +71,7 @@ import Foundation
             MSALNativeAuthLogger.logPII(
                 level: .error,
                 context: context,
-                format: "Clearing MSAL token cache for the current account failed with error %@: \(MSALLogMaskWrapper.maskEUII(error))"
+                format: "Clearing MSAL token cache for the current account failed with error: \(MSALLogMaskWrapper.maskEUII(error))"
             )
         }
     }
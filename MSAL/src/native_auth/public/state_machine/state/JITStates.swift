@@ -40,22 +40,24 @@ public class RegisterStrongAuthBaseState: MSALNativeAuthBaseState {
     }
 
     func baseRequestChallenge(authMethod: MSALAuthMethod, verificationContact: String, delegate: RegisterStrongAuthChallengeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await requestChallengeInternal(authMethod: authMethod, verificationContact: verificationContact)
-            let delegateDispatcher = JITRequestChallengeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
-            switch controllerResponse.result {
-            case .verificationRequired(let sentTo, let channelTargetType, let codeLength, let newState):
-                await delegateDispatcher.dispatchVerificationRequired(
-                    newState: newState,
-                    sentTo: sentTo,
-                    channelTargetType: channelTargetType,
-                    codeLength: codeLength,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .completed(let accountResult):
-                await delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
-            case .error(let error, let newState):
-                await delegate.onRegisterStrongAuthChallengeError(error: error, newState: newState)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = JITRequestChallengeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+                switch controllerResponse.result {
+                case .verificationRequired(let sentTo, let channelTargetType, let codeLength, let newState):
+                    delegateDispatcher.dispatchVerificationRequired(
+                        newState: newState,
+                        sentTo: sentTo,
+                        channelTargetType: channelTargetType,
+                        codeLength: codeLength,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .completed(let accountResult):
+                    delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
+                case .error(let error, let newState):
+                    delegate.onRegisterStrongAuthChallengeError(error: error, newState: newState)
+                }
             }
         }
     }
@@ -93,14 +95,16 @@ public class RegisterStrongAuthVerificationRequiredState: RegisterStrongAuthBase
     ///  - challenge: Verification challenge that the user supplies.
     ///  - delegate: Delegate that receives callbacks for the operation.
     public func submitChallenge(challenge: String, delegate: RegisterStrongAuthSubmitChallengeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await submitChallengeInternal(challenge: challenge)
-            let delegateDispatcher = JITSubmitChallengeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
-            switch controllerResponse.result {
-            case .completed(let accountResult):
-                await delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
-            case .error(let error, let newState):
-                await delegate.onRegisterStrongAuthSubmitChallengeError(error: error, newState: newState)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = JITSubmitChallengeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+                switch controllerResponse.result {
+                case .completed(let accountResult):
+                    delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
+                case .error(let error, let newState):
+                    delegate.onRegisterStrongAuthSubmitChallengeError(error: error, newState: newState)
+                }
             }
         }
     }
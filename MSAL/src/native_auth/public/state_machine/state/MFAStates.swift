@@ -43,26 +43,28 @@ import Foundation
     }
 
     func baseRequestChallenge(authMethod: MSALAuthMethod, delegate: MFARequestChallengeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await requestChallengeInternal(authMethod: authMethod)
-            let delegateDispatcher = MFARequestChallengeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
-            switch controllerResponse.result {
-            case .verificationRequired(let sentTo, let channelTargetType, let codeLength, let newState):
-                await delegateDispatcher.dispatchVerificationRequired(
-                    newState: newState,
-                    sentTo: sentTo,
-                    channelTargetType: channelTargetType,
-                    codeLength: codeLength,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .selectionRequired(let authMethods, let newState):
-                await delegateDispatcher.dispatchSelectionRequired(
-                    authMethods: authMethods,
-                    newState: newState,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .error(let error, let newState):
-                await delegate.onMFARequestChallengeError(error: error, newState: newState)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = MFARequestChallengeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+                switch controllerResponse.result {
+                case .verificationRequired(let sentTo, let channelTargetType, let codeLength, let newState):
+                    delegateDispatcher.dispatchVerificationRequired(
+                        newState: newState,
+                        sentTo: sentTo,
+                        channelTargetType: channelTargetType,
+                        codeLength: codeLength,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .selectionRequired(let authMethods, let newState):
+                    delegateDispatcher.dispatchSelectionRequired(
+                        authMethods: authMethods,
+                        newState: newState,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .error(let error, let newState):
+                    delegate.onMFARequestChallengeError(error: error, newState: newState)
+                }
             }
         }
     }
@@ -115,14 +117,16 @@ public class MFARequiredState: MFABaseState {
     ///   - challenge: Verification challenge that the user supplies.
     ///   - delegate: Delegate that receives callbacks for the operation.
     public func submitChallenge(challenge: String, delegate: MFASubmitChallengeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await submitChallengeInternal(challenge: challenge)
-            let delegateDispatcher = MFASubmitChallengeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
-            switch controllerResponse.result {
-            case .completed(let result):
-                await delegateDispatcher.dispatchSignInCompleted(result: result, correlationId: controllerResponse.correlationId)
-            case .error(let error, let newState):
-                await delegate.onMFASubmitChallengeError(error: error, newState: newState)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = MFASubmitChallengeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+                switch controllerResponse.result {
+                case .completed(let result):
+                    delegateDispatcher.dispatchSignInCompleted(result: result, correlationId: controllerResponse.correlationId)
+                case .error(let error, let newState):
+                    delegate.onMFASubmitChallengeError(error: error, newState: newState)
+                }
             }
         }
     }
@@ -50,24 +50,26 @@ public class ResetPasswordBaseState: MSALNativeAuthBaseState {
     /// Requests the server to resend the verification code to the user.
     /// - Parameter delegate: Delegate that receives callbacks for the operation.
     public func resendCode(delegate: ResetPasswordResendCodeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await resendCodeInternal()
-            let delegateDispatcher = ResetPasswordResendCodeDelegateDispatcher(
-                delegate: delegate,
-                telemetryUpdate: controllerResponse.telemetryUpdate
-            )
-
-            switch controllerResponse.result {
-            case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
-                await delegateDispatcher.dispatchResetPasswordResendCodeRequired(
-                    newState: newState,
-                    sentTo: sentTo,
-                    channelTargetType: channelTargetType,
-                    codeLength: codeLength,
-                    correlationId: controllerResponse.correlationId
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = ResetPasswordResendCodeDelegateDispatcher(
+                    delegate: delegate,
+                    telemetryUpdate: controllerResponse.telemetryUpdate
                 )
-            case .error(let error, let newState):
-                await delegate.onResetPasswordResendCodeError(error: error, newState: newState)
+
+                switch controllerResponse.result {
+                case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
+                    delegateDispatcher.dispatchResetPasswordResendCodeRequired(
+                        newState: newState,
+                        sentTo: sentTo,
+                        channelTargetType: channelTargetType,
+                        codeLength: codeLength,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .error(let error, let newState):
+                    delegate.onResetPasswordResendCodeError(error: error, newState: newState)
+                }
             }
         }
     }
@@ -77,18 +79,20 @@ public class ResetPasswordBaseState: MSALNativeAuthBaseState {
     ///   - code: Verification code that the user supplied.
     ///   - delegate: Delegate that receives callbacks for the operation.
     public func submitCode(code: String, delegate: ResetPasswordVerifyCodeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await submitCodeInternal(code: code)
-            let delegateDispatcher = ResetPasswordVerifyCodeDelegateDispatcher(
-                delegate: delegate,
-                telemetryUpdate: controllerResponse.telemetryUpdate
-            )
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = ResetPasswordVerifyCodeDelegateDispatcher(
+                    delegate: delegate,
+                    telemetryUpdate: controllerResponse.telemetryUpdate
+                )
 
-            switch controllerResponse.result {
-            case .passwordRequired(let newState):
-                await delegateDispatcher.dispatchPasswordRequired(newState: newState, correlationId: controllerResponse.correlationId)
-            case .error(let error, let newState):
-                await delegate.onResetPasswordVerifyCodeError(error: error, newState: newState)
+                switch controllerResponse.result {
+                case .passwordRequired(let newState):
+                    delegateDispatcher.dispatchPasswordRequired(newState: newState, correlationId: controllerResponse.correlationId)
+                case .error(let error, let newState):
+                    delegate.onResetPasswordVerifyCodeError(error: error, newState: newState)
+                }
             }
         }
     }
@@ -101,15 +105,17 @@ public class ResetPasswordBaseState: MSALNativeAuthBaseState {
     ///   - password: Password that the user supplied.
     ///   - delegate: Delegate that receives callbacks for the operation.
     public func submitPassword(password: String, delegate: ResetPasswordRequiredDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await submitPasswordInternal(password: password)
-            let delegateDispatcher = ResetPasswordRequiredDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = ResetPasswordRequiredDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            switch controllerResponse.result {
-            case .completed(let newState):
-                await delegateDispatcher.dispatchResetPasswordCompleted(newState: newState, correlationId: controllerResponse.correlationId)
-            case .error(let error, let newState):
-                await delegate.onResetPasswordRequiredError(error: error, newState: newState)
+                switch controllerResponse.result {
+                case .completed(let newState):
+                    delegateDispatcher.dispatchResetPasswordCompleted(newState: newState, correlationId: controllerResponse.correlationId)
+                case .error(let error, let newState):
+                    delegate.onResetPasswordRequiredError(error: error, newState: newState)
+                }
             }
         }
     }
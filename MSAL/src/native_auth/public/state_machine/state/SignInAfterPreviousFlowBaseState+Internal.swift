@@ -29,9 +29,10 @@ extension SignInAfterPreviousFlowBaseState {
     func signInInternal(
         scopes: [String]?,
         claimsRequestJson: String?,
-        telemetryId: MSALNativeAuthTelemetryApiId
+        telemetryId: MSALNativeAuthTelemetryApiId,
+        timeoutInterval: TimeInterval = 0
     ) async -> MSALNativeAuthSignInControlling.SignInAfterPreviousFlowControllerResponse {
-        let context = MSALNativeAuthRequestContext(correlationId: correlationId)
+        let context = MSALNativeAuthRequestContext(correlationId: correlationId, timeoutInterval: timeoutInterval)
         return await controller.signIn(
             username: username,
             grantType: nil,
@@ -31,38 +31,41 @@ import Foundation
     ///   - parameters: Parameters used to Sign In the user after the Reset Password flow.
     ///   - delegate: Delegate that receives callbacks for the Sign In flow.
     public func signIn(parameters: MSALNativeAuthSignInAfterResetPasswordParameters, delegate: SignInAfterResetPasswordDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let claimsRequestJson = parameters.claimsRequest?.jsonString()
             let controllerResponse = await signInInternal(
                 scopes: parameters.scopes,
                 claimsRequestJson: claimsRequestJson,
-                telemetryId: .telemetryApiIdSignInAfterPasswordReset
+                telemetryId: .telemetryApiIdSignInAfterPasswordReset,
+                timeoutInterval: parameters.timeoutInterval
             )
-            let delegateDispatcher = SignInAfterResetPasswordDelegateDispatcher(
-                delegate: delegate,
-                telemetryUpdate: controllerResponse.telemetryUpdate
-            )
-
-            switch controllerResponse.result {
-            case .completed(let accountResult):
-                await delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
-            case .awaitingMFA(authMethods: let authMethods, newState: let newState):
-                await delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
-            case .jitAuthMethodsSelectionRequired(authMethods: let authMethods, newState: let newState):
-                await delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
-            case .error(let error):
-                let signInAfterResetPassword = SignInAfterResetPasswordError(
-                    type: error.type,
-                    message: error.errorDescription,
-                    correlationId: error.correlationId,
-                    errorCodes: error.errorCodes,
-                    errorUri: error.errorUri
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = SignInAfterResetPasswordDelegateDispatcher(
+                    delegate: delegate,
+                    telemetryUpdate: controllerResponse.telemetryUpdate
                 )
-                await delegate.onSignInAfterResetPasswordError(error: signInAfterResetPassword)
+
+                switch controllerResponse.result {
+                case .completed(let accountResult):
+                    delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
+                case .awaitingMFA(authMethods: let authMethods, newState: let newState):
+                    delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                case .jitAuthMethodsSelectionRequired(authMethods: let authMethods, newState: let newState):
+                    delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                case .error(let error):
+                    let signInAfterResetPassword = SignInAfterResetPasswordError(
+                        type: error.type,
+                        message: error.errorDescription,
+                        correlationId: error.correlationId,
+                        errorCodes: error.errorCodes,
+                        errorUri: error.errorUri
+                    )
+                    delegate.onSignInAfterResetPasswordError(error: signInAfterResetPassword)
+                }
             }
         }
     }
@@ -32,35 +32,38 @@ import Foundation
     ///   - parameters: Parameters used to Sign In the user after the Sign Up flow.
     ///   - delegate: Delegate that receives callbacks for the Sign In flow.
     public func signIn(parameters: MSALNativeAuthSignInAfterSignUpParameters, delegate: SignInAfterSignUpDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let claimsRequestJson = parameters.claimsRequest?.jsonString()
             let controllerResponse = await signInInternal(
                 scopes: parameters.scopes,
                 claimsRequestJson: claimsRequestJson,
-                telemetryId: .telemetryApiIdSignInAfterSignUp
+                telemetryId: .telemetryApiIdSignInAfterSignUp,
+                timeoutInterval: parameters.timeoutInterval
             )
-            let delegateDispatcher = SignInAfterSignUpDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = SignInAfterSignUpDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            switch controllerResponse.result {
-            case .completed(let accountResult):
-                await delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
-            case .awaitingMFA(authMethods: let authMethods, newState: let newState):
-                await delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
-            case .jitAuthMethodsSelectionRequired(authMethods: let authMethods, newState: let newState):
-                await delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
-            case .error(let error):
-                let signInAfterSignUpError = SignInAfterSignUpError(
-                    type: error.type,
-                    message: error.errorDescription,
-                    correlationId: error.correlationId,
-                    errorCodes: error.errorCodes,
-                    errorUri: error.errorUri
-                )
-                await delegate.onSignInAfterSignUpError(error: signInAfterSignUpError)
+                switch controllerResponse.result {
+                case .completed(let accountResult):
+                    delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
+                case .awaitingMFA(authMethods: let authMethods, newState: let newState):
+                    delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                case .jitAuthMethodsSelectionRequired(authMethods: let authMethods, newState: let newState):
+                    delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                case .error(let error):
+                    let signInAfterSignUpError = SignInAfterSignUpError(
+                        type: error.type,
+                        message: error.errorDescription,
+                        correlationId: error.correlationId,
+                        errorCodes: error.errorCodes,
+                        errorUri: error.errorUri
+                    )
+                    delegate.onSignInAfterSignUpError(error: signInAfterSignUpError)
+                }
             }
         }
     }
@@ -68,21 +68,23 @@ import Foundation
     /// Requests the server to resend the verification code to the user.
     /// - Parameter delegate: Delegate that receives callbacks for the operation.
     public func resendCode(delegate: SignInResendCodeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await resendCodeInternal()
-            let delegateDispatcher = SignInResendCodeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = SignInResendCodeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            switch controllerResponse.result {
-            case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
-                await delegateDispatcher.dispatchSignInResendCodeCodeRequired(
-                    newState: newState,
-                    sentTo: sentTo,
-                    channelTargetType: channelTargetType,
-                    codeLength: codeLength,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .error(let error, let newState):
-                await delegate.onSignInResendCodeError(error: error, newState: newState)
+                switch controllerResponse.result {
+                case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
+                    delegateDispatcher.dispatchSignInResendCodeCodeRequired(
+                        newState: newState,
+                        sentTo: sentTo,
+                        channelTargetType: channelTargetType,
+                        codeLength: codeLength,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .error(let error, let newState):
+                    delegate.onSignInResendCodeError(error: error, newState: newState)
+                }
             }
         }
     }
@@ -92,23 +94,25 @@ import Foundation
     ///   - code: Verification code that the user supplies.
     ///   - delegate: Delegate that receives callbacks for the operation.
     public func submitCode(code: String, delegate: SignInVerifyCodeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await submitCodeInternal(code: code)
-            let delegateDispatcher = SignInVerifyCodeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = SignInVerifyCodeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            switch controllerResponse.result {
-            case .completed(let accountResult):
-                await delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
-            case .error(let error, let newState):
-                await delegate.onSignInVerifyCodeError(error: error, newState: newState)
-            case .awaitingMFA(let authMethods, let newState):
-                await delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
-            case .jitAuthMethodsSelectionRequired(let authMethods, let newState):
-                await delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
+                switch controllerResponse.result {
+                case .completed(let accountResult):
+                    delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
+                case .error(let error, let newState):
+                    delegate.onSignInVerifyCodeError(error: error, newState: newState)
+                case .awaitingMFA(let authMethods, let newState):
+                    delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                case .jitAuthMethodsSelectionRequired(let authMethods, let newState):
+                    delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                }
             }
         }
     }
@@ -144,23 +148,25 @@ import Foundation
     ///   - password: Password that the user supplied.
     ///   - delegate: Delegate that receives callbacks for the operation.
     public func submitPassword(password: String, delegate: SignInPasswordRequiredDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await submitPasswordInternal(password: password)
-            let delegateDispatcher = SignInPasswordRequiredDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = SignInPasswordRequiredDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            switch controllerResponse.result {
-            case .completed(let accountResult):
-                await delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
-            case .error(let error, let newState):
-                await delegate.onSignInPasswordRequiredError(error: error, newState: newState)
-            case .awaitingMFA(let authMethods, let newState):
-                await delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
-            case .jitAuthMethodsSelectionRequired(let authMethods, let newState):
-                await delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
-                                                             newState: newState,
-                                                             correlationId: controllerResponse.correlationId)
+                switch controllerResponse.result {
+                case .completed(let accountResult):
+                    delegateDispatcher.dispatchSignInCompleted(result: accountResult, correlationId: controllerResponse.correlationId)
+                case .error(let error, let newState):
+                    delegate.onSignInPasswordRequiredError(error: error, newState: newState)
+                case .awaitingMFA(let authMethods, let newState):
+                    delegateDispatcher.dispatchAwaitingMFA(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                case .jitAuthMethodsSelectionRequired(let authMethods, let newState):
+                    delegateDispatcher.dispatchJITRequired(authMethods: authMethods,
+                                                           newState: newState,
+                                                           correlationId: controllerResponse.correlationId)
+                }
             }
         }
     }
@@ -50,22 +50,23 @@ public class SignUpBaseState: MSALNativeAuthBaseState {
     /// Requests the server to resend the verification code to the user.
     /// - Parameter delegate: Delegate that receives callbacks for the operation.
     public func resendCode(delegate: SignUpResendCodeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await resendCodeInternal()
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = SignUpResendCodeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            let delegateDispatcher = SignUpResendCodeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
-
-            switch controllerResponse.result {
-            case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
-                await delegateDispatcher.dispatchSignUpResendCodeCodeRequired(
-                    newState: newState,
-                    sentTo: sentTo,
-                    channelTargetType: channelTargetType,
-                    codeLength: codeLength,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .error(let error, let newState):
-                await delegate.onSignUpResendCodeError(error: error, newState: newState)
+                switch controllerResponse.result {
+                case .codeRequired(let newState, let sentTo, let channelTargetType, let codeLength):
+                    delegateDispatcher.dispatchSignUpResendCodeCodeRequired(
+                        newState: newState,
+                        sentTo: sentTo,
+                        channelTargetType: channelTargetType,
+                        codeLength: codeLength,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .error(let error, let newState):
+                    delegate.onSignUpResendCodeError(error: error, newState: newState)
+                }
             }
         }
     }
@@ -75,23 +76,25 @@ public class SignUpBaseState: MSALNativeAuthBaseState {
     ///   - code: Verification code that the user supplies.
     ///   - delegate: Delegate that receives callbacks for the operation.
     public func submitCode(code: String, delegate: SignUpVerifyCodeDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await submitCodeInternal(code: code)
-            let delegateDispatcher = SignUpVerifyCodeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = SignUpVerifyCodeDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            switch controllerResponse.result {
-            case .completed(let state):
-                await delegateDispatcher.dispatchSignUpCompleted(newState: state, correlationId: controllerResponse.correlationId)
-            case .passwordRequired(let state):
-                await delegateDispatcher.dispatchSignUpPasswordRequired(newState: state, correlationId: controllerResponse.correlationId)
-            case .attributesRequired(let attributes, let state):
-                await delegateDispatcher.dispatchSignUpAttributesRequired(
-                    attributes: attributes,
-                    newState: state,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .error(let error, let state):
-                await delegate.onSignUpVerifyCodeError(error: error, newState: state)
+                switch controllerResponse.result {
+                case .completed(let state):
+                    delegateDispatcher.dispatchSignUpCompleted(newState: state, correlationId: controllerResponse.correlationId)
+                case .passwordRequired(let state):
+                    delegateDispatcher.dispatchSignUpPasswordRequired(newState: state, correlationId: controllerResponse.correlationId)
+                case .attributesRequired(let attributes, let state):
+                    delegateDispatcher.dispatchSignUpAttributesRequired(
+                        attributes: attributes,
+                        newState: state,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .error(let error, let state):
+                    delegate.onSignUpVerifyCodeError(error: error, newState: state)
+                }
             }
         }
     }
@@ -105,22 +108,23 @@ public class SignUpBaseState: MSALNativeAuthBaseState {
     ///   - password: Password that the user supplied.
     ///   - delegate: Delegate that receives callbacks for the operation.
     public func submitPassword(password: String, delegate: SignUpPasswordRequiredDelegate) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await submitPasswordInternal(password: password)
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = SignUpPasswordRequiredDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
 
-            let delegateDispatcher = SignUpPasswordRequiredDelegateDispatcher(delegate: delegate, telemetryUpdate: controllerResponse.telemetryUpdate)
-
-            switch controllerResponse.result {
-            case .completed(let state):
-                await delegateDispatcher.dispatchSignUpCompleted(newState: state, correlationId: controllerResponse.correlationId)
-            case .attributesRequired(let attributes, let state):
-                await delegateDispatcher.dispatchSignUpAttributesRequired(
-                    attributes: attributes,
-                    newState: state,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .error(let error, let state):
-                await delegate.onSignUpPasswordRequiredError(error: error, newState: state)
+                switch controllerResponse.result {
+                case .completed(let state):
+                    delegateDispatcher.dispatchSignUpCompleted(newState: state, correlationId: controllerResponse.correlationId)
+                case .attributesRequired(let attributes, let state):
+                    delegateDispatcher.dispatchSignUpAttributesRequired(
+                        attributes: attributes,
+                        newState: state,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .error(let error, let state):
+                    delegate.onSignUpPasswordRequiredError(error: error, newState: state)
+                }
             }
         }
     }
@@ -136,31 +140,32 @@ public class SignUpBaseState: MSALNativeAuthBaseState {
         attributes: [String: Any],
         delegate: SignUpAttributesRequiredDelegate
     ) {
-        Task {
+        controller.flowTasks.run { [self] in
             let controllerResponse = await submitAttributesInternal(attributes: attributes)
-
-            let delegateDispatcher = SignUpAttributesRequiredDelegateDispatcher(
-                delegate: delegate,
-                telemetryUpdate: controllerResponse.telemetryUpdate
-            )
-
-            switch controllerResponse.result {
-            case .completed(let state):
-                await delegateDispatcher.dispatchSignUpCompleted(newState: state, correlationId: controllerResponse.correlationId)
-            case .error(let error):
-                await delegate.onSignUpAttributesRequiredError(error: error)
-            case .attributesRequired(let attributes, let state):
-                await delegateDispatcher.dispatchSignUpAttributesRequired(
-                    attributes: attributes,
-                    newState: state,
-                    correlationId: controllerResponse.correlationId
-                )
-            case .attributesInvalid(let attributes, let state):
-                await delegateDispatcher.dispatchSignUpAttributesInvalid(
-                    attributeNames: attributes,
-                    newState: state,
-                    correlationId: controllerResponse.correlationId
+            await controller.flowTasks.deliver {
+                let delegateDispatcher = SignUpAttributesRequiredDelegateDispatcher(
+                    delegate: delegate,
+                    telemetryUpdate: controllerResponse.telemetryUpdate
                 )
+
+                switch controllerResponse.result {
+                case .completed(let state):
+                    delegateDispatcher.dispatchSignUpCompleted(newState: state, correlationId: controllerResponse.correlationId)
+                case .error(let error):
+                    delegate.onSignUpAttributesRequiredError(error: error)
+                case .attributesRequired(let attributes, let state):
+                    delegateDispatcher.dispatchSignUpAttributesRequired(
+                        attributes: attributes,
+                        newState: state,
+                        correlationId: controllerResponse.correlationId
+                    )
+                case .attributesInvalid(let attributes, let state):
+                    delegateDispatcher.dispatchSignUpAttributesInvalid(
+                        attributeNames: attributes,
+                        newState: state,
+                        correlationId: controllerResponse.correlationId
+                    )
+                }
             }
         }
     }
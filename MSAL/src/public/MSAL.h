@@ -46,6 +46,7 @@ FOUNDATION_EXPORT const unsigned char MSAL__Framework_VersionString[];
 #import <MSAL/MSALGlobalConfig.h>
 #import <MSAL/MSALLoggerConfig.h>
 #import <MSAL/MSALTelemetryConfig.h>
+#import <MSAL/MSALMetricsSnapshot.h>
 #import <MSAL/MSALHTTPConfig.h>
 #import <MSAL/MSALCacheConfig.h>
 #import <MSAL/MSALPublicClientApplication.h>
@@ -289,6 +289,13 @@ typedef void (^MSALLogCallback)(MSALLogLevel level, NSString * _Nullable message
  */
 typedef void(^MSALTelemetryCallback)(NSDictionary<NSString *, NSString *> * _Nonnull event);
 
+/**
+ MSAL batched telemetry callback.
+ 
+ @param events Aggregated telemetry events in the order they were emitted.
+ */
+typedef void(^MSALTelemetryBatchCallback)(NSArray<NSDictionary<NSString *, NSString *> *> * _Nonnull events);
+
 #endif /* MSALConstants_h */
 
 typedef NS_ENUM(NSUInteger, MSALAuthScheme)
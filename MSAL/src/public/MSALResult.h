@@ -30,6 +30,7 @@
 @class MSALAccount;
 @class MSALAuthority;
 @class MSALTenantProfile;
+@class MSALAuthenticationSchemePop;
 
 /**
     MSALResult represents information returned to the application after a successful interactive or silent token acquisition.
@@ -104,4 +105,17 @@ NS_SWIFT_SENDABLE
  */
 @property (atomic, readonly, nonnull) NSString *authenticationScheme;
 
+#pragma mark - Proof-of-Possession
+
+/**
+ Signs the Proof-of-Possession access token of this result for each of the provided PoP schemes and returns the matching authorization headers.
+ Each scheme describes one protected request (HTTP method, request URL and nonce). Signing runs in parallel and reuses the same PoP key, so this is much cheaper than a silent token request per URL.
+ 
+ @param popSchemes  PoP schemes describing the requests to sign. The returned array has the same order.
+ @param error       Set if the result doesn't hold a PoP access token or if any of the requests could not be signed.
+ @return Authorization headers, e.g. "PoP ...", or nil on failure.
+ */
+- (nullable NSArray<NSString *> *)authorizationHeadersForPopSchemes:(nonnull NSArray<MSALAuthenticationSchemePop *> *)popSchemes
+                                                              error:(NSError * _Nullable __autoreleasing * _Nullable)error;
+
 @end
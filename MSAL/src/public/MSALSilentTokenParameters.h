@@ -51,6 +51,14 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic) BOOL allowUsingLocalCachedRtWhenSsoExtFailed;
 
+/**
+ Return a cached access token that is inside the refresh window (see MSALPublicClientApplicationConfig.tokenExpirationBuffer) immediately,
+ instead of waiting for the network, and refresh it in the background.
+ The token is only returned if it is no more than MSALPublicClientApplicationConfig.maximumTokenStaleness seconds into the refresh window.
+ Ignored when forceRefresh is set or a claims request is provided. Default is NO.
+ */
+@property (nonatomic) BOOL allowStaleTokenWhileRevalidating;
+
 #pragma mark - Constructing MSALSilentTokenParameters
 
 /**
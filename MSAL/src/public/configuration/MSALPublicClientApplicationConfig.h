@@ -77,6 +77,12 @@ NS_ASSUME_NONNULL_BEGIN
  about to expire. */
 @property (nonatomic) double tokenExpirationBuffer;
 
+/** Time in seconds controlling how far into the tokenExpirationBuffer window a cached access token can still be returned
+ when MSALSilentTokenParameters.allowStaleTokenWhileRevalidating is set. Such token is returned immediately and refreshed in the background.
+ The value is capped at tokenExpirationBuffer, so the returned token is always valid for at least (tokenExpirationBuffer - maximumTokenStaleness) seconds.
+ Default is 240 seconds. */
+@property (nonatomic) double maximumTokenStaleness;
+
 /** Used to specify query parameters that must be passed to both the authorize and token endpoints
 to target MSAL at a specific test slice & flight. These apply to all requests made by an application. */
 @property (nullable) MSALSliceConfig *sliceConfig;
@@ -40,6 +40,7 @@ NS_ASSUME_NONNULL_BEGIN
 /**
  Number of retry attemps to be made in case of a network error,
  with error code 500 ~ 599.
+ @note Native authentication requests ignore this setting and `retryInterval`, they use a retry policy chosen per endpoint.
  */
 @property NSInteger retryCount;
 /**
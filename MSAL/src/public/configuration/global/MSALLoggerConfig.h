@@ -42,6 +42,16 @@ typedef NS_ENUM(NSInteger, MSALLogMaskingLevel)
     MSALLogMaskingSettingsMaskSecretsOnly
 };
 
+/*! Log line dropped when the asynchronous log queue is full */
+typedef NS_ENUM(NSInteger, MSALLogOverflowPolicy)
+{
+    /** The oldest queued log line is dropped to make room for the new one. */
+    MSALLogOverflowPolicyDropOldest,
+    
+    /** The new log line is dropped. */
+    MSALLogOverflowPolicyDropNewest
+};
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -82,6 +92,53 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (MSALLogCallback)callback;
 
+#pragma mark - Logs of failed requests
+
+/**
+ If set YES, MSAL keeps the native authentication log lines above `logLevel` of each in-flight request in memory.
+ When a request fails, its kept lines are delivered to the logging callback, when it succeeds they are discarded.
+ This gives full diagnostics for failed requests while logging at a lower level otherwise. `logLevel` itself is not changed,
+ so the rest of the process keeps logging at that level, and lines are only formatted for the requests being captured.
+ Default is NO.
+ */
+@property (atomic) BOOL captureLogsForFailedRequests;
+
+/**
+ Maximum number of log lines kept per request when `captureLogsForFailedRequests` is enabled, older lines are dropped first. Default is 256.
+ */
+@property (atomic) NSUInteger maxCapturedLogLinesPerRequest;
+
+#pragma mark - Asynchronous log delivery
+
+/**
+ Delivers log messages to the logging callback on a dedicated background thread instead of the thread that logged them.
+ Log lines are kept in a bounded queue, so logging never waits for the callback. When the queue is full, a line is dropped according to overflowPolicy and counted in `droppedLogCount`.
+ 
+ @note This can be enabled only once per process, and it should be enabled early in the program's execution.
+ 
+ @param capacity    Maximum number of log lines waiting for delivery, rounded up to the next power of two.
+ @param overflowPolicy  Which log line to drop when the queue is full.
+ */
+- (void)enableAsynchronousLogDeliveryWithQueueCapacity:(NSUInteger)capacity
+                                        overflowPolicy:(MSALLogOverflowPolicy)overflowPolicy;
+
+/**
+ Whether log messages are delivered asynchronously.
+ */
+@property (atomic, readonly) BOOL asynchronousLogDeliveryEnabled;
+
+/**
+ Number of log lines dropped because the asynchronous log queue was full.
+ */
+@property (atomic, readonly) NSUInteger droppedLogCount;
+
+/**
+ Synchronously delivers all queued log lines to the logging callback on the calling thread,
+ after waiting up to 2 seconds for a delivery already in progress. The callback is never called concurrently.
+ Call this before the app is suspended in the background or from a crash handler, so queued log lines aren't lost.
+ */
+- (void)flushLogs;
+
 
 #pragma mark - Unavailable initializers
 
@@ -0,0 +1,74 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <Foundation/Foundation.h>
+
+/**
+ Number of buckets in every MSAL latency histogram.
+ */
+#define MSAL_METRICS_HISTOGRAM_BUCKET_COUNT 12
+
+/**
+ Upper bounds in milliseconds (inclusive) of the latency histogram buckets: 1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 5000 and unbounded.
+ */
+FOUNDATION_EXPORT const uint32_t MSALMetricsHistogramBucketUpperBoundsMs[MSAL_METRICS_HISTOGRAM_BUCKET_COUNT];
+
+/**
+ Fixed-bucket latency histogram.
+ */
+typedef struct
+{
+    /** Number of recorded samples. */
+    uint64_t count;
+    /** Sum of all samples in microseconds. */
+    uint64_t totalMicroseconds;
+    /** Largest sample in microseconds. */
+    uint64_t maxMicroseconds;
+    /** Sample count per bucket, see MSALMetricsHistogramBucketUpperBoundsMs. */
+    uint64_t buckets[MSAL_METRICS_HISTOGRAM_BUCKET_COUNT];
+} MSALHistogramSnapshot;
+
+/**
+ Point in time copy of the metrics MSAL collects in process since launch or since the last reset.
+ */
+typedef struct
+{
+    /** Latency of acquireTokenSilent requests from call to completion. */
+    MSALHistogramSnapshot silentTokenLatency;
+    /** Successful silent requests served from the token cache. */
+    uint64_t cacheHits;
+    /** Successful silent requests that got a new token from the network, SSO extension or broker. Failed silent requests aren't counted. */
+    uint64_t cacheMisses;
+    /** HTTP requests retried by the native authentication retry policy. Retries of other MSAL requests aren't counted. */
+    uint64_t nativeAuthHttpRetries;
+    /** Latency of the keychain read of an account's sign-in state on the silent path, when it isn't cached in memory. */
+    MSALHistogramSnapshot signInStateReadLatency;
+    /** Latency of keychain writes done by MSAL. */
+    MSALHistogramSnapshot keychainWriteLatency;
+    /** Latency of account and device information queries to the SSO extension. Token requests served by the SSO extension are part of silentTokenLatency. */
+    MSALHistogramSnapshot ssoExtensionQueryLatency;
+} MSALMetricsSnapshot;
@@ -27,6 +27,7 @@
 
 #import <Foundation/Foundation.h>
 #import "MSALDefinitions.h"
+#import "MSALMetricsSnapshot.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -49,6 +50,28 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (atomic) BOOL notifyOnFailureOnly;
 
+/**
+ Fraction of requests between 0 and 1 for which telemetry events are built and dispatched, unless a rate is set for the API id. Default is 1.
+ The decision is made once per correlation id, so all events of a request are either kept or skipped.
+ Failed requests that were not sampled still dispatch a single API event with the error.
+ */
+@property (atomic) double samplingRate;
+
+/**
+ Sets the sampling rate for requests made through the API identified by apiId, overriding `samplingRate`.
+ */
+- (void)setSamplingRate:(double)samplingRate forApiId:(NSInteger)apiId;
+
+/**
+ Returns the sampling rate applied to requests made through the API identified by apiId.
+ */
+- (double)samplingRateForApiId:(NSInteger)apiId;
+
+/**
+ Removes all sampling rates set with `setSamplingRate:forApiId:`.
+ */
+- (void)removeAllSamplingRates;
+
 #pragma mark - Listening to telemetry events
 
 /**
@@ -56,6 +79,46 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (atomic, copy, nullable) MSALTelemetryCallback telemetryCallback;
 
+/**
+ Invoked on a background queue with batches of telemetry events.
+ Events are buffered only while this callback is set, so the token path doesn't wait for the app to process them.
+ If the buffer is full, new events are dropped and counted in `droppedEventCount`.
+ */
+@property (atomic, copy, nullable) MSALTelemetryBatchCallback telemetryBatchCallback;
+
+/**
+ Maximum number of events delivered in one batch. A batch is delivered as soon as this many events are buffered. Default is 50.
+ */
+@property (atomic) NSUInteger batchSize;
+
+/**
+ Maximum time in seconds an event waits in the buffer before it's delivered in a partial batch. Default is 10 seconds.
+ */
+@property (atomic) NSTimeInterval batchFlushInterval;
+
+/**
+ Number of events dropped because the telemetry buffer was full.
+ */
+@property (atomic, readonly) NSUInteger droppedEventCount;
+
+/**
+ Asynchronously delivers all buffered events to `telemetryBatchCallback`.
+ */
+- (void)flushTelemetryBatch;
+
+#pragma mark - Metrics
+
+/**
+ Returns a copy of the counters and latency histograms MSAL collected in this process.
+ Collecting metrics is lock-free and always on, so this can be sampled periodically instead of processing telemetry events.
+ */
+- (MSALMetricsSnapshot)metricsSnapshot;
+
+/**
+ Resets all metrics counters and histograms to zero.
+ */
+- (void)resetMetrics;
+
 #pragma mark - Unavailable initializers
 
 /**
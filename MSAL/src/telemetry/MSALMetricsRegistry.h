@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <Foundation/Foundation.h>
+#import "MSALMetricsSnapshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, MSALMetricsCounter)
+{
+    MSALMetricsCounterCacheHit,
+    MSALMetricsCounterCacheMiss,
+    MSALMetricsCounterNativeAuthHttpRetry
+};
+
+typedef NS_ENUM(NSInteger, MSALMetricsHistogram)
+{
+    MSALMetricsHistogramSilentTokenLatency,
+    MSALMetricsHistogramSignInStateReadLatency,
+    MSALMetricsHistogramKeychainWriteLatency,
+    MSALMetricsHistogramSsoExtensionQueryLatency
+};
+
+/// In-process counters and latency histograms. Recording is lock-free and safe from any thread.
+@interface MSALMetricsRegistry : NSObject
+
++ (instancetype)sharedRegistry NS_SWIFT_NAME(shared());
+
+/// Monotonic timestamp to pass to recordLatencySinceStartTime:histogram:.
++ (uint64_t)currentTime;
+
+- (void)incrementCounter:(MSALMetricsCounter)counter;
+- (void)recordLatencySinceStartTime:(uint64_t)startTime histogram:(MSALMetricsHistogram)histogram;
+- (void)recordLatencyMicroseconds:(uint64_t)microseconds histogram:(MSALMetricsHistogram)histogram;
+
+- (MSALMetricsSnapshot)snapshot;
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import "MSALMetricsRegistry.h"
+#import <stdatomic.h>
+#import <time.h>
+
+#define MSAL_METRICS_COUNTER_COUNT 3
+#define MSAL_METRICS_HISTOGRAM_COUNT 4
+
+const uint32_t MSALMetricsHistogramBucketUpperBoundsMs[MSAL_METRICS_HISTOGRAM_BUCKET_COUNT] = { 1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 5000, UINT32_MAX };
+
+typedef struct
+{
+    _Atomic(uint64_t) count;
+    _Atomic(uint64_t) totalMicroseconds;
+    _Atomic(uint64_t) maxMicroseconds;
+    _Atomic(uint64_t) buckets[MSAL_METRICS_HISTOGRAM_BUCKET_COUNT];
+} MSALAtomicHistogram;
+
+static size_t MSALHistogramBucketIndex(uint64_t microseconds)
+{
+    for (size_t i = 0; i < MSAL_METRICS_HISTOGRAM_BUCKET_COUNT - 1; i++)
+    {
+        if (microseconds <= (uint64_t)MSALMetricsHistogramBucketUpperBoundsMs[i] * 1000) return i;
+    }
+    
+    return MSAL_METRICS_HISTOGRAM_BUCKET_COUNT - 1;
+}
+
+static MSALHistogramSnapshot MSALHistogramSnapshotFromAtomic(MSALAtomicHistogram *histogram)
+{
+    MSALHistogramSnapshot snapshot;
+    snapshot.count = atomic_load_explicit(&histogram->count, memory_order_relaxed);
+    snapshot.totalMicroseconds = atomic_load_explicit(&histogram->totalMicroseconds, memory_order_relaxed);
+    snapshot.maxMicroseconds = atomic_load_explicit(&histogram->maxMicroseconds, memory_order_relaxed);
+    
+    for (size_t i = 0; i < MSAL_METRICS_HISTOGRAM_BUCKET_COUNT; i++)
+    {
+        snapshot.buckets[i] = atomic_load_explicit(&histogram->buckets[i], memory_order_relaxed);
+    }
+    
+    return snapshot;
+}
+
+@implementation MSALMetricsRegistry
+{
+    _Atomic(uint64_t) _counters[MSAL_METRICS_COUNTER_COUNT];
+    MSALAtomicHistogram _histograms[MSAL_METRICS_HISTOGRAM_COUNT];
+}
+
++ (instancetype)sharedRegistry
+{
+    static MSALMetricsRegistry *sharedRegistry = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedRegistry = [self new];
+    });
+    
+    return sharedRegistry;
+}
+
++ (uint64_t)currentTime
+{
+    return clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self)
+    {
+        [self reset];
+    }
+    
+    return self;
+}
+
+- (void)incrementCounter:(MSALMetricsCounter)counter
+{
+    if (counter < 0 || counter >= MSAL_METRICS_COUNTER_COUNT) return;
+    
+    atomic_fetch_add_explicit(&_counters[counter], 1, memory_order_relaxed);
+}
+
+- (void)recordLatencySinceStartTime:(uint64_t)startTime histogram:(MSALMetricsHistogram)histogram
+{
+    uint64_t now = [MSALMetricsRegistry currentTime];
+    [self recordLatencyMicroseconds:now > startTime ? (now - startTime) / NSEC_PER_USEC : 0 histogram:histogram];
+}
+
+- (void)recordLatencyMicroseconds:(uint64_t)microseconds histogram:(MSALMetricsHistogram)histogram
+{
+    if (histogram < 0 || histogram >= MSAL_METRICS_HISTOGRAM_COUNT) return;
+    
+    MSALAtomicHistogram *atomicHistogram = &_histograms[histogram];
+    atomic_fetch_add_explicit(&atomicHistogram->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&atomicHistogram->totalMicroseconds, microseconds, memory_order_relaxed);
+    atomic_fetch_add_explicit(&atomicHistogram->buckets[MSALHistogramBucketIndex(microseconds)], 1, memory_order_relaxed);
+    
+    uint64_t currentMax = atomic_load_explicit(&atomicHistogram->maxMicroseconds, memory_order_relaxed);
+    while (microseconds > currentMax
+           && !atomic_compare_exchange_weak_explicit(&atomicHistogram->maxMicroseconds, &currentMax, microseconds, memory_order_relaxed, memory_order_relaxed));
+}
+
+- (MSALMetricsSnapshot)snapshot
+{
+    MSALMetricsSnapshot snapshot;
+    snapshot.silentTokenLatency = MSALHistogramSnapshotFromAtomic(&_histograms[MSALMetricsHistogramSilentTokenLatency]);
+    snapshot.cacheHits = atomic_load_explicit(&_counters[MSALMetricsCounterCacheHit], memory_order_relaxed);
+    snapshot.cacheMisses = atomic_load_explicit(&_counters[MSALMetricsCounterCacheMiss], memory_order_relaxed);
+    snapshot.nativeAuthHttpRetries = atomic_load_explicit(&_counters[MSALMetricsCounterNativeAuthHttpRetry], memory_order_relaxed);
+    snapshot.signInStateReadLatency = MSALHistogramSnapshotFromAtomic(&_histograms[MSALMetricsHistogramSignInStateReadLatency]);
+    snapshot.keychainWriteLatency = MSALHistogramSnapshotFromAtomic(&_histograms[MSALMetricsHistogramKeychainWriteLatency]);
+    snapshot.ssoExtensionQueryLatency = MSALHistogramSnapshotFromAtomic(&_histograms[MSALMetricsHistogramSsoExtensionQueryLatency]);
+    return snapshot;
+}
+
+- (void)reset
+{
+    for (size_t i = 0; i < MSAL_METRICS_COUNTER_COUNT; i++)
+    {
+        atomic_store_explicit(&_counters[i], 0, memory_order_relaxed);
+    }
+    
+    for (size_t i = 0; i < MSAL_METRICS_HISTOGRAM_COUNT; i++)
+    {
+        atomic_store_explicit(&_histograms[i].count, 0, memory_order_relaxed);
+        atomic_store_explicit(&_histograms[i].totalMicroseconds, 0, memory_order_relaxed);
+        atomic_store_explicit(&_histograms[i].maxMicroseconds, 0, memory_order_relaxed);
+        
+        for (size_t bucket = 0; bucket < MSAL_METRICS_HISTOGRAM_BUCKET_COUNT; bucket++)
+        {
+            atomic_store_explicit(&_histograms[i].buckets[bucket], 0, memory_order_relaxed);
+        }
+    }
+}
+
+@end
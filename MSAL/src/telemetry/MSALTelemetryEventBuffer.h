@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Bounded lock-free multi-producer ring buffer of telemetry events.
+/// Any thread can add events, removal is expected to happen from a single consumer queue.
+@interface MSALTelemetryEventBuffer : NSObject
+
+/// Capacity is rounded up to the next power of two.
+- (instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, readonly) NSUInteger capacity;
+
+/// Approximate number of events currently in the buffer.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// Number of events rejected because the buffer was full.
+@property (nonatomic, readonly) NSUInteger droppedEventCount;
+
+/// Adds event without blocking. Returns NO and counts the event as dropped if the buffer is full.
+- (BOOL)addEvent:(NSDictionary<NSString *, NSString *> *)event;
+
+/// Removes up to maxCount events in the order they were added.
+- (NSArray<NSDictionary<NSString *, NSString *> *> *)removeEventsWithMaxCount:(NSUInteger)maxCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import "MSALTelemetryEventBuffer.h"
+#import <stdatomic.h>
+
+// Bounded MPMC queue by Dmitry Vyukov, every slot carries a sequence number telling
+// producers and the consumer whose turn it is, so no locks are taken on either side.
+typedef struct
+{
+    _Atomic(NSUInteger) sequence;
+    void *event;
+} MSALTelemetryEventSlot;
+
+@implementation MSALTelemetryEventBuffer
+{
+    MSALTelemetryEventSlot *_slots;
+    NSUInteger _mask;
+    _Atomic(NSUInteger) _enqueuePosition;
+    _Atomic(NSUInteger) _dequeuePosition;
+    _Atomic(NSUInteger) _droppedEventCount;
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity
+{
+    self = [super init];
+    if (self)
+    {
+        NSUInteger roundedCapacity = 2;
+        while (roundedCapacity < capacity) roundedCapacity <<= 1;
+        
+        _capacity = roundedCapacity;
+        _mask = roundedCapacity - 1;
+        _slots = calloc(roundedCapacity, sizeof(MSALTelemetryEventSlot));
+        
+        if (!_slots) return nil;
+        
+        for (NSUInteger i = 0; i < roundedCapacity; i++)
+        {
+            atomic_init(&_slots[i].sequence, i);
+        }
+        
+        atomic_init(&_enqueuePosition, 0);
+        atomic_init(&_dequeuePosition, 0);
+        atomic_init(&_droppedEventCount, 0);
+    }
+    
+    return self;
+}
+
+- (void)dealloc
+{
+    // Release events that were never delivered.
+    [self removeEventsWithMaxCount:NSUIntegerMax];
+    free(_slots);
+}
+
+- (NSUInteger)count
+{
+    NSUInteger enqueuePosition = atomic_load_explicit(&_enqueuePosition, memory_order_relaxed);
+    NSUInteger dequeuePosition = atomic_load_explicit(&_dequeuePosition, memory_order_relaxed);
+    return enqueuePosition > dequeuePosition ? MIN(enqueuePosition - dequeuePosition, _capacity) : 0;
+}
+
+- (NSUInteger)droppedEventCount
+{
+    return atomic_load_explicit(&_droppedEventCount, memory_order_relaxed);
+}
+
+- (BOOL)addEvent:(NSDictionary<NSString *, NSString *> *)event
+{
+    MSALTelemetryEventSlot *slot;
+    NSUInteger position = atomic_load_explicit(&_enqueuePosition, memory_order_relaxed);
+    
+    for (;;)
+    {
+        slot = &_slots[position & _mask];
+        NSUInteger sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+        
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&_enqueuePosition, &position, position + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            atomic_fetch_add_explicit(&_droppedEventCount, 1, memory_order_relaxed);
+            return NO;
+        }
+        else
+        {
+            position = atomic_load_explicit(&_enqueuePosition, memory_order_relaxed);
+        }
+    }
+    
+    slot->event = (void *)CFBridgingRetain(event);
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+    return YES;
+}
+
+- (NSArray<NSDictionary<NSString *, NSString *> *> *)removeEventsWithMaxCount:(NSUInteger)maxCount
+{
+    NSMutableArray *events = [NSMutableArray new];
+    
+    while (events.count < maxCount)
+    {
+        MSALTelemetryEventSlot *slot;
+        NSUInteger position = atomic_load_explicit(&_dequeuePosition, memory_order_relaxed);
+        
+        for (;;)
+        {
+            slot = &_slots[position & _mask];
+            NSUInteger sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+            intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+            
+            if (difference == 0)
+            {
+                if (atomic_compare_exchange_weak_explicit(&_dequeuePosition, &position, position + 1, memory_order_relaxed, memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return events;
+            }
+            else
+            {
+                position = atomic_load_explicit(&_dequeuePosition, memory_order_relaxed);
+            }
+        }
+        
+        id event = CFBridgingRelease(slot->event);
+        slot->event = NULL;
+        atomic_store_explicit(&slot->sequence, position + _mask + 1, memory_order_release);
+        
+        [events addObject:event];
+    }
+    
+    return events;
+}
+
+@end
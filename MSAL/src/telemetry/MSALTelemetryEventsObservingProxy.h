@@ -30,6 +30,17 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, copy, nullable) MSALTelemetryCallback telemetryCallback;
 
+/// Receives buffered events in batches on a background queue. Events are only buffered while it is set.
+@property (atomic, copy, nullable) MSALTelemetryBatchCallback batchCallback;
+@property (atomic) NSUInteger batchSize;
+@property (atomic) NSTimeInterval batchFlushInterval;
+@property (nonatomic, readonly) NSUInteger droppedEventCount;
+
+- (instancetype)initWithBufferCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/// Delivers everything that is currently buffered, asynchronously.
+- (void)flushBatch;
+
 @end
 
 NS_ASSUME_NONNULL_END
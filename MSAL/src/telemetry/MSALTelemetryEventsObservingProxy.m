@@ -23,7 +23,59 @@
 
 #import "MSALTelemetryEventsObservingProxy.h"
 
+#import "MSALTelemetryEventBuffer.h"
+#import <stdatomic.h>
+
+static const NSUInteger MSALDefaultTelemetryBufferCapacity = 1024;
+static const NSUInteger MSALDefaultTelemetryBatchSize = 50;
+static const NSTimeInterval MSALDefaultTelemetryBatchFlushInterval = 10;
+
+@interface MSALTelemetryEventsObservingProxy()
+
+@property (nonatomic) MSALTelemetryEventBuffer *buffer;
+@property (nonatomic) dispatch_queue_t deliveryQueue;
+
+@end
+
 @implementation MSALTelemetryEventsObservingProxy
+{
+    atomic_bool _flushTimerScheduled;
+    atomic_bool _fullBatchDeliveryScheduled;
+}
+
+- (instancetype)init
+{
+    return [self initWithBufferCapacity:MSALDefaultTelemetryBufferCapacity];
+}
+
+- (instancetype)initWithBufferCapacity:(NSUInteger)capacity
+{
+    self = [super init];
+    if (self)
+    {
+        _buffer = [[MSALTelemetryEventBuffer alloc] initWithCapacity:capacity];
+        _deliveryQueue = dispatch_queue_create("com.microsoft.msal.telemetry.batch", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+        _batchSize = MSALDefaultTelemetryBatchSize;
+        _batchFlushInterval = MSALDefaultTelemetryBatchFlushInterval;
+        atomic_init(&_flushTimerScheduled, false);
+        atomic_init(&_fullBatchDeliveryScheduled, false);
+    }
+    
+    return self;
+}
+
+- (NSUInteger)droppedEventCount
+{
+    return self.buffer.droppedEventCount;
+}
+
+- (void)flushBatch
+{
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.deliveryQueue, ^{
+        [weakSelf deliverBufferedEventsFullBatchesOnly:NO];
+    });
+}
 
 #pragma mark - MSIDTelemetryEventsObserving
 
@@ -34,6 +86,73 @@
     if (!aggregatedEvent) return;
     
     if (self.telemetryCallback != nil) self.telemetryCallback(aggregatedEvent);
+    
+    if (self.batchCallback == nil) return;
+    
+    BOOL added = NO;
+    for (NSDictionary<NSString *, NSString *> *event in events)
+    {
+        added |= [self.buffer addEvent:event];
+    }
+    
+    if (!added) return;
+    
+    if (self.buffer.count >= MAX(self.batchSize, 1))
+    {
+        [self scheduleFullBatchDelivery];
+    }
+    
+    [self scheduleFlushTimer];
+}
+
+#pragma mark - Private
+
+- (void)scheduleFullBatchDelivery
+{
+    bool expected = false;
+    if (!atomic_compare_exchange_strong(&_fullBatchDeliveryScheduled, &expected, true)) return;
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(self.deliveryQueue, ^{
+        typeof(self) strongSelf = weakSelf;
+        if (!strongSelf) return;
+        
+        atomic_store(&strongSelf->_fullBatchDeliveryScheduled, false);
+        [strongSelf deliverBufferedEventsFullBatchesOnly:YES];
+    });
+}
+
+- (void)scheduleFlushTimer
+{
+    // Makes sure a partial batch is delivered even if it never fills up.
+    bool expected = false;
+    if (!atomic_compare_exchange_strong(&_flushTimerScheduled, &expected, true)) return;
+    
+    __weak typeof(self) weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.batchFlushInterval * NSEC_PER_SEC)), self.deliveryQueue, ^{
+        typeof(self) strongSelf = weakSelf;
+        if (!strongSelf) return;
+        
+        atomic_store(&strongSelf->_flushTimerScheduled, false);
+        [strongSelf deliverBufferedEventsFullBatchesOnly:NO];
+    });
+}
+
+- (void)deliverBufferedEventsFullBatchesOnly:(BOOL)fullBatchesOnly
+{
+    NSUInteger batchSize = MAX(self.batchSize, 1);
+    
+    while (!fullBatchesOnly || self.buffer.count >= batchSize)
+    {
+        NSArray<NSDictionary<NSString *, NSString *> *> *batch = [self.buffer removeEventsWithMaxCount:batchSize];
+        
+        if (!batch.count) break;
+        
+        MSALTelemetryBatchCallback batchCallback = self.batchCallback;
+        if (batchCallback) batchCallback(batch);
+    }
+    
+    if (self.buffer.count) [self scheduleFlushTimer];
 }
 
 @end
@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Decides per request whether telemetry events are built and dispatched.
+/// The decision is deterministic per correlation id, so every event of a request is either kept or skipped.
+@interface MSALTelemetrySampler : NSObject
+
++ (instancetype)sharedSampler NS_SWIFT_NAME(shared());
+
+/// Sampling rate between 0 and 1 used for API ids without an explicit rate. Default is 1.
+@property (atomic) double defaultSamplingRate;
+
+- (void)setSamplingRate:(double)samplingRate forApiId:(NSInteger)apiId;
+- (double)samplingRateForApiId:(NSInteger)apiId;
+- (void)removeAllSamplingRates;
+
+- (BOOL)shouldSampleApiId:(NSInteger)apiId correlationId:(nullable NSUUID *)correlationId;
+
+/// Remembers that the request with telemetryRequestId was not sampled, so that its events are dropped and a failure can still be reported when it completes.
+- (void)markUnsampledRequest:(NSString *)telemetryRequestId apiId:(NSInteger)apiId;
+
+- (BOOL)isUnsampledRequest:(NSString *)telemetryRequestId;
+
+/// Returns YES if the request was not sampled and forgets about it.
+- (BOOL)completeUnsampledRequest:(NSString *)telemetryRequestId apiId:(nullable NSInteger *)apiId;
+
+/// Builds and dispatches a minimal API event for a failed request that was not sampled.
+- (void)dispatchFailureEventForApiId:(NSInteger)apiId
+                       correlationId:(nullable NSUUID *)correlationId
+                            clientId:(nullable NSString *)clientId
+                               error:(NSError *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
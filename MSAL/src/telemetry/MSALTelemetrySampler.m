@@ -0,0 +1,190 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import "MSALTelemetrySampler.h"
+#import "MSIDTelemetry.h"
+#import "MSIDTelemetry+Internal.h"
+#import "MSIDTelemetryAPIEvent.h"
+#import "MSIDTelemetryEventStrings.h"
+#import "MSIDBasicContext.h"
+
+// Unsampled requests that never complete shouldn't grow this without bound, the oldest one is evicted first.
+static const NSUInteger MSALMaxTrackedUnsampledRequests = 256;
+
+@interface MSALTelemetrySampler()
+
+@property (nonatomic) NSMutableDictionary<NSNumber *, NSNumber *> *samplingRates;
+@property (nonatomic) NSMutableDictionary<NSString *, NSNumber *> *unsampledRequests;
+@property (nonatomic) NSMutableOrderedSet<NSString *> *unsampledRequestsOrder;
+
+@end
+
+@implementation MSALTelemetrySampler
+
++ (instancetype)sharedSampler
+{
+    static MSALTelemetrySampler *sharedSampler = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedSampler = [self new];
+    });
+    
+    return sharedSampler;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self)
+    {
+        _defaultSamplingRate = 1;
+        _samplingRates = [NSMutableDictionary new];
+        _unsampledRequests = [NSMutableDictionary new];
+        _unsampledRequestsOrder = [NSMutableOrderedSet new];
+    }
+    
+    return self;
+}
+
+#pragma mark - Rates
+
+- (void)setSamplingRate:(double)samplingRate forApiId:(NSInteger)apiId
+{
+    @synchronized (self)
+    {
+        self.samplingRates[@(apiId)] = @(samplingRate);
+    }
+}
+
+- (double)samplingRateForApiId:(NSInteger)apiId
+{
+    @synchronized (self)
+    {
+        NSNumber *samplingRate = self.samplingRates[@(apiId)];
+        return samplingRate ? samplingRate.doubleValue : self.defaultSamplingRate;
+    }
+}
+
+- (void)removeAllSamplingRates
+{
+    @synchronized (self)
+    {
+        [self.samplingRates removeAllObjects];
+    }
+}
+
+- (BOOL)shouldSampleApiId:(NSInteger)apiId correlationId:(NSUUID *)correlationId
+{
+    double samplingRate = [self samplingRateForApiId:apiId];
+    
+    if (samplingRate >= 1) return YES;
+    if (samplingRate <= 0) return NO;
+    if (!correlationId) return YES;
+    
+    // FNV-1a over the correlation id bytes maps every request to a stable point in [0, 1).
+    uuid_t bytes;
+    [correlationId getUUIDBytes:bytes];
+    
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < sizeof(uuid_t); i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    
+    return (double)(hash >> 11) / (double)(1ULL << 53) < samplingRate;
+}
+
+#pragma mark - Unsampled requests
+
+- (void)markUnsampledRequest:(NSString *)telemetryRequestId apiId:(NSInteger)apiId
+{
+    @synchronized (self)
+    {
+        if (![self.unsampledRequestsOrder containsObject:telemetryRequestId]
+            && self.unsampledRequestsOrder.count >= MSALMaxTrackedUnsampledRequests)
+        {
+            NSString *oldestRequestId = self.unsampledRequestsOrder.firstObject;
+            [self.unsampledRequestsOrder removeObjectAtIndex:0];
+            [self.unsampledRequests removeObjectForKey:oldestRequestId];
+        }
+        
+        [self.unsampledRequestsOrder addObject:telemetryRequestId];
+        self.unsampledRequests[telemetryRequestId] = @(apiId);
+    }
+}
+
+- (BOOL)isUnsampledRequest:(NSString *)telemetryRequestId
+{
+    @synchronized (self)
+    {
+        return self.unsampledRequests[telemetryRequestId] != nil;
+    }
+}
+
+- (BOOL)completeUnsampledRequest:(NSString *)telemetryRequestId apiId:(NSInteger *)apiId
+{
+    @synchronized (self)
+    {
+        NSNumber *unsampledApiId = self.unsampledRequests[telemetryRequestId];
+        if (!unsampledApiId) return NO;
+        
+        [self.unsampledRequests removeObjectForKey:telemetryRequestId];
+        [self.unsampledRequestsOrder removeObject:telemetryRequestId];
+        if (apiId) *apiId = unsampledApiId.integerValue;
+        return YES;
+    }
+}
+
+- (void)dispatchFailureEventForApiId:(NSInteger)apiId
+                       correlationId:(NSUUID *)correlationId
+                            clientId:(NSString *)clientId
+                               error:(NSError *)error
+{
+    MSIDBasicContext *context = [MSIDBasicContext new];
+    context.correlationId = correlationId;
+    context.telemetryRequestId = [[MSIDTelemetry sharedInstance] generateRequestId];
+    
+    MSIDTelemetryAPIEvent *event = [[MSIDTelemetryAPIEvent alloc] initWithName:MSID_TELEMETRY_EVENT_API_EVENT context:context];
+    [event setApiId:[NSString stringWithFormat:@"%ld", (long)apiId]];
+    [event setCorrelationId:correlationId];
+    [event setClientId:clientId];
+    
+    NSString *oauthErrorCode = error.userInfo[MSIDOAuthErrorKey];
+    if ([oauthErrorCode isKindOfClass:NSString.class]) [event setOauthErrorCode:oauthErrorCode];
+    
+    [event setErrorCodeString:[NSString stringWithFormat:@"%ld", (long)error.code]];
+    [event setErrorDomain:error.domain];
+    [event setResultStatus:MSID_TELEMETRY_VALUE_FAILED];
+    [event setIsSuccessfulStatus:MSID_TELEMETRY_VALUE_NO];
+    
+    [[MSIDTelemetry sharedInstance] startEvent:context.telemetryRequestId eventName:MSID_TELEMETRY_EVENT_API_EVENT];
+    [[MSIDTelemetry sharedInstance] stopEvent:context.telemetryRequestId event:event];
+    [[MSIDTelemetry sharedInstance] flush:context.telemetryRequestId];
+}
+
+@end
@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+#import <Foundation/Foundation.h>
+#import "MSALDefinitions.h"
+#import "MSALLoggerConfig.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Bounded lock-free multi-producer queue of log lines delivered to a log callback on a single consumer thread.
+/// Logging threads never wait for the callback, when the queue is full a line is dropped according to the overflow policy.
+@interface MSALAsyncLogQueue : NSObject
+
+/// Capacity is rounded up to the next power of two.
+- (nullable instancetype)initWithCapacity:(NSUInteger)capacity
+                           overflowPolicy:(MSALLogOverflowPolicy)overflowPolicy
+                                 callback:(MSALLogCallback)callback NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+@property (nonatomic, readonly) NSUInteger capacity;
+@property (nonatomic, readonly) MSALLogOverflowPolicy overflowPolicy;
+
+/// Longest time flush waits for a delivery in progress on the consumer thread. Defaults to 2 seconds.
+@property (nonatomic) NSTimeInterval flushTimeout;
+
+/// Number of log lines dropped because the queue was full.
+@property (nonatomic, readonly) NSUInteger droppedLogCount;
+
+/// Adds a log line without blocking and wakes up the consumer thread if it's idle.
+- (void)enqueueLogWithLevel:(MSALLogLevel)level message:(nullable NSString *)message containsPII:(BOOL)containsPII;
+
+/// Waits for the delivery in progress on the consumer thread, delivers the remaining queued log lines on the calling thread
+/// and returns once the callback has received them. The callback is never called concurrently.
+/// Returns right away when called from the callback, and without delivering when the consumer doesn't finish within flushTimeout.
+- (void)flush;
+
+@end
+
+NS_ASSUME_NONNULL_END
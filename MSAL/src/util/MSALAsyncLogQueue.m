@@ -0,0 +1,293 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+#import "MSALAsyncLogQueue.h"
+#import <stdatomic.h>
+#import <pthread.h>
+
+static const NSTimeInterval MSALDefaultLogFlushTimeout = 2;
+
+// Same bounded MPMC queue as MSALTelemetryEventBuffer. Dropping the oldest line dequeues from the
+// producer side, which the per-slot sequence numbers allow alongside the consumer thread.
+typedef struct
+{
+    _Atomic(NSUInteger) sequence;
+    MSALLogLevel level;
+    BOOL containsPII;
+    void *message;
+} MSALLogSlot;
+
+@implementation MSALAsyncLogQueue
+{
+    MSALLogSlot *_slots;
+    NSUInteger _mask;
+    _Atomic(NSUInteger) _enqueuePosition;
+    _Atomic(NSUInteger) _dequeuePosition;
+    _Atomic(NSUInteger) _droppedLogCount;
+    atomic_bool _consumerIdle;
+    dispatch_semaphore_t _wakeUpSemaphore;
+    // Guards _delivering and _deliveringThread. The callback is only called by the thread that set _delivering.
+    NSCondition *_deliveryCondition;
+    BOOL _delivering;
+    pthread_t _deliveringThread;
+    MSALLogCallback _callback;
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity
+                  overflowPolicy:(MSALLogOverflowPolicy)overflowPolicy
+                        callback:(MSALLogCallback)callback
+{
+    self = [super init];
+    if (self)
+    {
+        NSUInteger roundedCapacity = 2;
+        while (roundedCapacity < capacity) roundedCapacity <<= 1;
+        
+        _capacity = roundedCapacity;
+        _mask = roundedCapacity - 1;
+        _overflowPolicy = overflowPolicy;
+        _flushTimeout = MSALDefaultLogFlushTimeout;
+        _callback = [callback copy];
+        _slots = calloc(roundedCapacity, sizeof(MSALLogSlot));
+        
+        if (!_slots) return nil;
+        
+        for (NSUInteger i = 0; i < roundedCapacity; i++)
+        {
+            atomic_init(&_slots[i].sequence, i);
+        }
+        
+        atomic_init(&_enqueuePosition, 0);
+        atomic_init(&_dequeuePosition, 0);
+        atomic_init(&_droppedLogCount, 0);
+        atomic_init(&_consumerIdle, false);
+        _wakeUpSemaphore = dispatch_semaphore_create(0);
+        _deliveryCondition = [NSCondition new];
+        
+        NSThread *consumerThread = [[NSThread alloc] initWithTarget:self selector:@selector(runConsumer) object:nil];
+        consumerThread.name = @"com.microsoft.msal.logging";
+        consumerThread.qualityOfService = NSQualityOfServiceUtility;
+        [consumerThread start];
+    }
+    
+    return self;
+}
+
+- (NSUInteger)droppedLogCount
+{
+    return atomic_load_explicit(&_droppedLogCount, memory_order_relaxed);
+}
+
+#pragma mark - Producers
+
+- (void)enqueueLogWithLevel:(MSALLogLevel)level message:(NSString *)message containsPII:(BOOL)containsPII
+{
+    while (![self tryEnqueueLogWithLevel:level message:message containsPII:containsPII])
+    {
+        if (self.overflowPolicy == MSALLogOverflowPolicyDropNewest)
+        {
+            atomic_fetch_add_explicit(&_droppedLogCount, 1, memory_order_relaxed);
+            return;
+        }
+        
+        // Make room by discarding the oldest line, then try again.
+        MSALLogSlot oldest;
+        if ([self dequeueLog:&oldest])
+        {
+            atomic_fetch_add_explicit(&_droppedLogCount, 1, memory_order_relaxed);
+            if (oldest.message) CFRelease(oldest.message);
+        }
+    }
+    
+    if (atomic_exchange_explicit(&_consumerIdle, false, memory_order_acq_rel))
+    {
+        dispatch_semaphore_signal(_wakeUpSemaphore);
+    }
+}
+
+- (BOOL)tryEnqueueLogWithLevel:(MSALLogLevel)level message:(NSString *)message containsPII:(BOOL)containsPII
+{
+    MSALLogSlot *slot;
+    NSUInteger position = atomic_load_explicit(&_enqueuePosition, memory_order_relaxed);
+    
+    for (;;)
+    {
+        slot = &_slots[position & _mask];
+        NSUInteger sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+        
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&_enqueuePosition, &position, position + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            return NO;
+        }
+        else
+        {
+            position = atomic_load_explicit(&_enqueuePosition, memory_order_relaxed);
+        }
+    }
+    
+    slot->level = level;
+    slot->containsPII = containsPII;
+    slot->message = message ? (void *)CFBridgingRetain([message copy]) : NULL;
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+    return YES;
+}
+
+#pragma mark - Consumer
+
+- (BOOL)dequeueLog:(MSALLogSlot *)log
+{
+    MSALLogSlot *slot;
+    NSUInteger position = atomic_load_explicit(&_dequeuePosition, memory_order_relaxed);
+    
+    for (;;)
+    {
+        slot = &_slots[position & _mask];
+        NSUInteger sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+        
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&_dequeuePosition, &position, position + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            return NO;
+        }
+        else
+        {
+            position = atomic_load_explicit(&_dequeuePosition, memory_order_relaxed);
+        }
+    }
+    
+    log->level = slot->level;
+    log->containsPII = slot->containsPII;
+    log->message = slot->message;
+    slot->message = NULL;
+    atomic_store_explicit(&slot->sequence, position + _mask + 1, memory_order_release);
+    return YES;
+}
+
+- (BOOL)isEmpty
+{
+    return atomic_load_explicit(&_enqueuePosition, memory_order_acquire) == atomic_load_explicit(&_dequeuePosition, memory_order_acquire);
+}
+
+- (BOOL)beginDeliveryBeforeDate:(NSDate *)deadline
+{
+    [_deliveryCondition lock];
+    while (_delivering)
+    {
+        if (![_deliveryCondition waitUntilDate:deadline])
+        {
+            [_deliveryCondition unlock];
+            return NO;
+        }
+    }
+    
+    _delivering = YES;
+    _deliveringThread = pthread_self();
+    [_deliveryCondition unlock];
+    return YES;
+}
+
+- (void)endDelivery
+{
+    [_deliveryCondition lock];
+    _delivering = NO;
+    [_deliveryCondition broadcast];
+    [_deliveryCondition unlock];
+}
+
+- (BOOL)isDeliveringOnCurrentThread
+{
+    [_deliveryCondition lock];
+    BOOL delivering = _delivering && pthread_equal(_deliveringThread, pthread_self());
+    [_deliveryCondition unlock];
+    return delivering;
+}
+
+- (void)deliverQueuedLogs
+{
+    [self beginDeliveryBeforeDate:[NSDate distantFuture]];
+    [self drainQueuedLogs];
+    [self endDelivery];
+}
+
+- (void)drainQueuedLogs
+{
+    MSALLogSlot log;
+    while ([self dequeueLog:&log])
+    {
+        @autoreleasepool
+        {
+            NSString *message = log.message ? CFBridgingRelease(log.message) : nil;
+            _callback(log.level, message, log.containsPII);
+        }
+    }
+}
+
+- (void)runConsumer
+{
+    for (;;)
+    {
+        [self deliverQueuedLogs];
+        
+        atomic_store_explicit(&_consumerIdle, true, memory_order_seq_cst);
+        
+        // A line enqueued before the idle flag was set wouldn't wake us up, so check again before sleeping.
+        if (![self isEmpty] && atomic_exchange_explicit(&_consumerIdle, false, memory_order_acq_rel))
+        {
+            continue;
+        }
+        
+        dispatch_semaphore_wait(_wakeUpSemaphore, DISPATCH_TIME_FOREVER);
+    }
+}
+
+- (void)flush
+{
+    // Called from the callback: the delivery in progress on this thread keeps draining once the callback returns.
+    if ([self isDeliveringOnCurrentThread]) return;
+    
+    // Wait for the consumer to hand over, so lines it already dequeued are delivered first and the callback stays serial.
+    if (![self beginDeliveryBeforeDate:[NSDate dateWithTimeIntervalSinceNow:self.flushTimeout]]) return;
+    
+    [self drainQueuedLogs];
+    [self endDelivery];
+}
+
+@end
@@ -0,0 +1,51 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ Bounded cache of parsed id token claims keyed by the SHA-256 digest of the raw id token.
+ Cache served silent results carry the same id token, so the base64 decoding and JSON parsing is done once
+ and the resulting immutable claims dictionary is shared by every MSALResult, MSALTenantProfile and MSALAccount built from it.
+ */
+@interface MSALIdTokenClaimsCache : NSObject
+
++ (instancetype)sharedCache;
+
+/*!
+ Returns immutable claims for the raw id token, parsing and caching them on a miss.
+ */
+- (nullable NSDictionary *)claimsForRawIdToken:(nullable NSString *)rawIdToken
+                                         error:(NSError * _Nullable __autoreleasing * _Nullable)error;
+
+- (void)removeAllClaims;
+
+@end
+
+NS_ASSUME_NONNULL_END
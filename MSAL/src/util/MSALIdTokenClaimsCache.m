@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import "MSALIdTokenClaimsCache.h"
+#import "MSIDIdTokenClaims.h"
+#import <CommonCrypto/CommonDigest.h>
+
+static NSUInteger const MSALIdTokenClaimsCacheCountLimit = 32;
+
+@interface MSALIdTokenClaimsCache()
+
+@property (nonatomic) NSCache<NSData *, NSDictionary *> *claimsCache;
+
+@end
+
+@implementation MSALIdTokenClaimsCache
+
++ (instancetype)sharedCache
+{
+    static MSALIdTokenClaimsCache *sharedCache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [MSALIdTokenClaimsCache new];
+    });
+    
+    return sharedCache;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self)
+    {
+        _claimsCache = [NSCache new];
+        _claimsCache.countLimit = MSALIdTokenClaimsCacheCountLimit;
+    }
+    return self;
+}
+
+- (NSDictionary *)claimsForRawIdToken:(NSString *)rawIdToken error:(NSError **)error
+{
+    if (!rawIdToken)
+    {
+        // Nothing to cache, let MSIDIdTokenClaims decide between an error and empty claims as it always did
+        MSIDIdTokenClaims *parsedClaims = [[MSIDIdTokenClaims alloc] initWithRawIdToken:rawIdToken error:error];
+        
+        if (!parsedClaims) return nil;
+        
+        return [parsedClaims.jsonDictionary copy] ?: @{};
+    }
+    
+    NSData *key = [self digestForRawIdToken:rawIdToken];
+    NSDictionary *claims = [self.claimsCache objectForKey:key];
+    
+    if (claims) return claims;
+    
+    MSIDIdTokenClaims *parsedClaims = [[MSIDIdTokenClaims alloc] initWithRawIdToken:rawIdToken error:error];
+    
+    if (!parsedClaims) return nil;
+    
+    // Callers share this dictionary, make sure nobody can mutate it
+    claims = [parsedClaims.jsonDictionary copy] ?: @{};
+    [self.claimsCache setObject:claims forKey:key];
+    return claims;
+}
+
+- (void)removeAllClaims
+{
+    [self.claimsCache removeAllObjects];
+}
+
+#pragma mark - Private
+
+- (NSData *)digestForRawIdToken:(NSString *)rawIdToken
+{
+    NSData *tokenData = [rawIdToken dataUsingEncoding:NSUTF8StringEncoding];
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(tokenData.bytes, (CC_LONG)tokenData.length, digest);
+    return [NSData dataWithBytes:digest length:CC_SHA256_DIGEST_LENGTH];
+}
+
+@end
@@ -0,0 +1,93 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import Foundation
+@_implementationOnly import MSAL_Private
+
+/// Swift concurrency overloads that propagate task cancellation to the underlying MSAL request.
+///
+/// Unlike the async variants that Swift synthesizes from the completion block based methods,
+/// cancelling the calling `Task` stops the request at its next stage (keychain lookup, network request),
+/// completes it immediately and throws `CancellationError`.
+extension MSALPublicClientApplication {
+
+    /// Acquire a token silently for an existing account, honoring task cancellation.
+    /// - Parameter parameters: Parameters used for the silent token request.
+    /// - Returns: The token result.
+    /// - Throws: `CancellationError` if the task was cancelled, otherwise the MSAL error returned by the request.
+    public func acquireTokenSilent(parameters: MSALSilentTokenParameters) async throws -> MSALResult {
+        try await performCancellable(parameters: parameters) { parameters, completion in
+            self.acquireTokenSilent(with: parameters, completionBlock: completion)
+        }
+    }
+
+    /// Read accounts from the cache and the broker, honoring task cancellation.
+    /// - Parameter parameters: Parameters used to filter the accounts.
+    /// - Returns: Accounts found on the device.
+    /// - Throws: `CancellationError` if the task was cancelled, otherwise the MSAL error returned by the request.
+    public func accountsFromDevice(parameters: MSALAccountEnumerationParameters) async throws -> [MSALAccount] {
+        try await performCancellable(parameters: parameters) { parameters, completion in
+            self.accountsFromDevice(for: parameters, completionBlock: completion)
+        }
+    }
+
+    /// Read device information, honoring task cancellation.
+    /// - Parameter parameters: Parameters for the request, a default instance is used when nil.
+    /// - Returns: Information about the device.
+    /// - Throws: `CancellationError` if the task was cancelled, otherwise the MSAL error returned by the request.
+    public func deviceInformation(parameters: MSALParameters? = nil) async throws -> MSALDeviceInformation {
+        let parameters = parameters ?? MSALParameters()
+        return try await performCancellable(parameters: parameters) { parameters, completion in
+            self.getDeviceInformation(with: parameters, completionBlock: completion)
+        }
+    }
+
+    // The cancellation signal is set on a copy, so parameters shared with other calls never see it.
+    private func performCancellable<P: MSALParameters, T>(
+        parameters: P,
+        start: (P, @escaping (T?, Error?) -> Void) -> Void
+    ) async throws -> T {
+        guard let requestParameters = parameters.copy() as? P else {
+            throw NSError(domain: MSALErrorDomain, code: MSALError.internal.rawValue)
+        }
+        let cancellation = MSALRequestCancellation()
+        requestParameters.cancellation = cancellation
+
+        return try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { (continuation: CheckedContinuation<T, Error>) in
+                start(requestParameters) { value, error in
+                    if cancellation.isCancelled {
+                        continuation.resume(throwing: CancellationError())
+                    } else if let value = value {
+                        continuation.resume(returning: value)
+                    } else {
+                        continuation.resume(throwing: error ?? NSError(domain: MSALErrorDomain, code: MSALError.internal.rawValue))
+                    }
+                }
+            }
+        } onCancel: {
+            cancellation.cancel()
+        }
+    }
+}
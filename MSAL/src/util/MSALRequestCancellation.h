@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef void (^MSALRequestCancellationHandler)(void);
+
+/*!
+ Cooperative cancellation signal shared between a caller (e.g. a Swift task) and an in-flight MSAL request.
+ MSAL checks it between request stages and completes the request with MSIDErrorUserCancel as soon as it is cancelled.
+ */
+@interface MSALRequestCancellation : NSObject
+
+@property (atomic, readonly, getter=isCancelled) BOOL cancelled;
+
+/*!
+ Marks the request as cancelled and invokes the registered handler exactly once.
+ */
+- (void)cancel;
+
+/*!
+ Registers the handler to invoke on cancellation. If the request was already cancelled, the handler is invoked immediately.
+ Only one handler is kept, registering a new handler replaces the previous one.
+ */
+- (void)setCancellationHandler:(nullable MSALRequestCancellationHandler)handler;
+
+/*!
+ Returns YES only for the first caller, so that either the request result or the cancellation completes the request, never both.
+ Also drops the registered handler.
+ */
+- (BOOL)tryMarkCompleted;
+
+@end
+
+NS_ASSUME_NONNULL_END
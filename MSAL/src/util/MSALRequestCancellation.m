@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import "MSALRequestCancellation.h"
+
+@interface MSALRequestCancellation()
+
+@property (atomic, readwrite, getter=isCancelled) BOOL cancelled;
+@property (nonatomic, nullable) MSALRequestCancellationHandler handler;
+@property (nonatomic) BOOL completed;
+
+@end
+
+@implementation MSALRequestCancellation
+
+- (void)cancel
+{
+    MSALRequestCancellationHandler handler = nil;
+    
+    @synchronized (self)
+    {
+        if (self.cancelled)
+        {
+            return;
+        }
+        
+        self.cancelled = YES;
+        handler = self.handler;
+        self.handler = nil;
+    }
+    
+    // Call handler outside of the lock, it may complete the request and release us.
+    if (handler) handler();
+}
+
+- (void)setCancellationHandler:(MSALRequestCancellationHandler)handler
+{
+    @synchronized (self)
+    {
+        if (!self.cancelled)
+        {
+            self.handler = handler;
+            return;
+        }
+    }
+    
+    if (handler) handler();
+}
+
+- (BOOL)tryMarkCompleted
+{
+    @synchronized (self)
+    {
+        self.handler = nil;
+        
+        if (self.completed)
+        {
+            return NO;
+        }
+        
+        self.completed = YES;
+        return YES;
+    }
+}
+
+@end
@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+#import <Foundation/Foundation.h>
+#import "MSALDefinitions.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface MSALCapturedLogLine : NSObject
+
+@property (nonatomic, readonly) MSALLogLevel level;
+@property (nonatomic, readonly, nullable) NSString *message;
+@property (nonatomic, readonly) BOOL containsPII;
+
+@end
+
+/// Keeps the most recent log lines of in-flight requests in bounded per-correlation-id ring buffers.
+/// While no request is being captured, isCapturingCorrelationId: returns NO without taking the lock.
+@interface MSALRequestLogCapture : NSObject
+
+/// Maximum number of lines kept per request, older lines are overwritten. Default is 256.
+@property (atomic) NSUInteger maxLinesPerRequest;
+
+/// Maximum number of requests captured at the same time, further requests aren't captured. Default is 64.
+@property (atomic) NSUInteger maxCapturedRequests;
+
+/// Number of requests currently being captured.
+@property (nonatomic, readonly) NSUInteger activeCaptureCount;
+
+/// Starts capturing lines logged with correlationId. Nested calls for the same correlation id are counted.
+- (void)beginCaptureForCorrelationId:(NSUUID *)correlationId;
+
+/// Returns YES while lines logged with correlationId are captured. Callers check it before formatting a line.
+- (BOOL)isCapturingCorrelationId:(nullable NSUUID *)correlationId;
+
+/// Stores the line if correlationId is being captured. Returns NO if the line wasn't captured.
+- (BOOL)captureLogWithLevel:(MSALLogLevel)level
+                    message:(nullable NSString *)message
+                containsPII:(BOOL)containsPII
+              correlationId:(nullable NSUUID *)correlationId;
+
+/// Stops capturing lines for correlationId and returns the captured lines in the order they were logged.
+/// Returns nil while nested captures for the same correlation id are still in progress.
+- (nullable NSArray<MSALCapturedLogLine *> *)endCaptureForCorrelationId:(NSUUID *)correlationId;
+
+- (void)discardAllCaptures;
+
+@end
+
+NS_ASSUME_NONNULL_END
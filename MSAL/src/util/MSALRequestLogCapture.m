@@ -0,0 +1,195 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+#import "MSALRequestLogCapture.h"
+#import <stdatomic.h>
+#import <os/lock.h>
+
+@implementation MSALCapturedLogLine
+
+- (instancetype)initWithLevel:(MSALLogLevel)level message:(NSString *)message containsPII:(BOOL)containsPII
+{
+    self = [super init];
+    if (self)
+    {
+        _level = level;
+        _message = [message copy];
+        _containsPII = containsPII;
+    }
+    
+    return self;
+}
+
+@end
+
+@interface MSALLogCaptureRing : NSObject
+
+@property (nonatomic) NSMutableArray<MSALCapturedLogLine *> *lines;
+@property (nonatomic) NSUInteger capacity;
+@property (nonatomic) NSUInteger nextIndex;
+@property (nonatomic) NSUInteger nestingCount;
+
+@end
+
+@implementation MSALLogCaptureRing
+
+- (void)addLine:(MSALCapturedLogLine *)line
+{
+    if (self.lines.count < self.capacity)
+    {
+        [self.lines addObject:line];
+        return;
+    }
+    
+    self.lines[self.nextIndex] = line;
+    self.nextIndex = (self.nextIndex + 1) % self.capacity;
+}
+
+- (NSArray<MSALCapturedLogLine *> *)orderedLines
+{
+    if (self.nextIndex == 0) return self.lines;
+    
+    NSRange newestRange = NSMakeRange(0, self.nextIndex);
+    NSRange oldestRange = NSMakeRange(self.nextIndex, self.lines.count - self.nextIndex);
+    return [[self.lines subarrayWithRange:oldestRange] arrayByAddingObjectsFromArray:[self.lines subarrayWithRange:newestRange]];
+}
+
+@end
+
+@implementation MSALRequestLogCapture
+{
+    os_unfair_lock _lock;
+    NSMutableDictionary<NSUUID *, MSALLogCaptureRing *> *_captures;
+    _Atomic(NSUInteger) _activeCaptureCount;
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self)
+    {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _captures = [NSMutableDictionary new];
+        _maxLinesPerRequest = 256;
+        _maxCapturedRequests = 64;
+        atomic_init(&_activeCaptureCount, 0);
+    }
+    
+    return self;
+}
+
+- (NSUInteger)activeCaptureCount
+{
+    return atomic_load_explicit(&_activeCaptureCount, memory_order_relaxed);
+}
+
+- (void)beginCaptureForCorrelationId:(NSUUID *)correlationId
+{
+    NSUInteger maxLinesPerRequest = MAX(self.maxLinesPerRequest, 1);
+    NSUInteger maxCapturedRequests = self.maxCapturedRequests;
+    
+    os_unfair_lock_lock(&_lock);
+    
+    MSALLogCaptureRing *ring = _captures[correlationId];
+    if (ring)
+    {
+        ring.nestingCount++;
+    }
+    else if (_captures.count < maxCapturedRequests)
+    {
+        ring = [MSALLogCaptureRing new];
+        ring.capacity = maxLinesPerRequest;
+        ring.lines = [NSMutableArray arrayWithCapacity:MIN(maxLinesPerRequest, 32)];
+        ring.nestingCount = 1;
+        _captures[correlationId] = ring;
+        atomic_store_explicit(&_activeCaptureCount, _captures.count, memory_order_relaxed);
+    }
+    
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (BOOL)isCapturingCorrelationId:(NSUUID *)correlationId
+{
+    if (!correlationId || atomic_load_explicit(&_activeCaptureCount, memory_order_relaxed) == 0) return NO;
+    
+    os_unfair_lock_lock(&_lock);
+    BOOL capturing = _captures[correlationId] != nil;
+    os_unfair_lock_unlock(&_lock);
+    
+    return capturing;
+}
+
+- (BOOL)captureLogWithLevel:(MSALLogLevel)level
+                    message:(NSString *)message
+                containsPII:(BOOL)containsPII
+              correlationId:(NSUUID *)correlationId
+{
+    if (!correlationId || atomic_load_explicit(&_activeCaptureCount, memory_order_relaxed) == 0) return NO;
+    
+    MSALCapturedLogLine *line = nil;
+    
+    os_unfair_lock_lock(&_lock);
+    
+    MSALLogCaptureRing *ring = _captures[correlationId];
+    if (ring)
+    {
+        line = [[MSALCapturedLogLine alloc] initWithLevel:level message:message containsPII:containsPII];
+        [ring addLine:line];
+    }
+    
+    os_unfair_lock_unlock(&_lock);
+    
+    return line != nil;
+}
+
+- (NSArray<MSALCapturedLogLine *> *)endCaptureForCorrelationId:(NSUUID *)correlationId
+{
+    NSArray *lines = nil;
+    
+    os_unfair_lock_lock(&_lock);
+    
+    MSALLogCaptureRing *ring = _captures[correlationId];
+    if (ring && --ring.nestingCount == 0)
+    {
+        lines = [ring orderedLines];
+        [_captures removeObjectForKey:correlationId];
+        atomic_store_explicit(&_activeCaptureCount, _captures.count, memory_order_relaxed);
+    }
+    
+    os_unfair_lock_unlock(&_lock);
+    
+    return lines;
+}
+
+- (void)discardAllCaptures
+{
+    os_unfair_lock_lock(&_lock);
+    [_captures removeAllObjects];
+    atomic_store_explicit(&_activeCaptureCount, 0, memory_order_relaxed);
+    os_unfair_lock_unlock(&_lock);
+}
+
+@end
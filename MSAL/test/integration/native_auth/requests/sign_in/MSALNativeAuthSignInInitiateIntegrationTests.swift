@@ -56,6 +56,16 @@ class MSALNativeAuthSignInInitiateIntegrationTests: MSALNativeAuthIntegrationBas
         XCTAssertNotNil(response?.continuationToken)
     }
 
+    func test_succeedRequest_afterServerErrorIsRetried() async throws {
+        try await mockAPIHandler.addResponse(
+            endpoint: .signInInitiate,
+            correlationId: correlationId,
+            responses: [.serverError, .initiateSuccess]
+        )
+        let response: MSALNativeAuthSignInInitiateResponse? = try await performTestSucceed()
+        XCTAssertNotNil(response?.continuationToken)
+    }
+
     func test_initiateSucceedRequest_challengeTypeRedirect() async throws {
         try await mockResponse(.challengeTypeRedirect, endpoint: .signInInitiate)
         let response: MSALNativeAuthSignInInitiateResponse? = try await performTestSucceed()
@@ -0,0 +1,108 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+@_implementationOnly import MSAL_Private
+
+/// Runs a password sign in that requires MFA through the controllers handed out by MSALNativeAuthControllerFactory,
+/// the way the public client application and the states do.
+final class MSALNativeAuthSignInMFAFlowIntegrationTests: MSALNativeAuthIntegrationBaseTests {
+
+    private var factory: MSALNativeAuthControllerFactory!
+    private var cacheAccessor: MSALNativeAuthCacheAccessor!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+
+        factory = MSALNativeAuthControllerFactory(config: config)
+        cacheAccessor = MSALNativeAuthCacheAccessor(
+            tokenCache: MSIDDefaultTokenCacheAccessor(dataSource: MSIDKeychainTokenCache(), otherCacheAccessors: []),
+            accountMetadataCache: MSIDAccountMetadataCacheAccessor(dataSource: MSIDKeychainTokenCache())
+        )
+    }
+
+    func test_signInWithMFAFlow_shouldRequestChallenge() async throws {
+        let verificationRequired = await runSignInWithMFAFlow()
+        XCTAssertTrue(verificationRequired)
+    }
+
+    func test_performance_signInWithMFAFlowAllocations() {
+        measure(metrics: [XCTMemoryMetric(), XCTClockMetric()]) {
+            let exp = expectation(description: "sign in with MFA flow")
+            Task {
+                _ = await runSignInWithMFAFlow()
+                exp.fulfill()
+            }
+            wait(for: [exp], timeout: defaultTimeout)
+        }
+    }
+
+    // MARK: - Helpers
+
+    private func runSignInWithMFAFlow() async -> Bool {
+        do {
+            try await mockAPIHandler.addResponse(endpoint: .signInInitiate, correlationId: correlationId, responses: [.initiateSuccess])
+            try await mockAPIHandler.addResponse(endpoint: .signInChallenge, correlationId: correlationId, responses: [.challengeTypePassword, .challengeTypeOOB])
+            try await mockAPIHandler.addResponse(endpoint: .signInToken, correlationId: correlationId, responses: [.mfaRequired, .tokenSuccess])
+            try await mockAPIHandler.addResponse(endpoint: .signInIntrospect, correlationId: correlationId, responses: [.signInIntrospectSuccess])
+        } catch {
+            XCTFail("Mock API responses could not be added: \(error)")
+            return false
+        }
+
+        let context = MSALNativeAuthRequestContext(correlationId: correlationId)
+        let signInController = factory.makeSignInController(cacheAccessor: cacheAccessor)
+        let signInResponse = await signInController.signIn(
+            params: .init(username: "user@contoso.com", password: "password", context: context, scopes: nil, claimsRequestJson: nil)
+        )
+
+        guard case .awaitingMFA(let authMethods, let awaitingMFAState) = signInResponse.result, let authMethod = authMethods.first else {
+            XCTFail("Sign in should require MFA")
+            return false
+        }
+
+        let challengeResponse = await awaitingMFAState.controller.requestChallenge(
+            continuationToken: awaitingMFAState.continuationToken,
+            authMethod: authMethod,
+            context: context,
+            scopes: awaitingMFAState.scopes,
+            claimsRequestJson: nil
+        )
+
+        guard case .verificationRequired(_, _, _, let mfaRequiredState) = challengeResponse.result else {
+            XCTFail("MFA challenge should require verification")
+            return false
+        }
+
+        _ = await mfaRequiredState.controller.submitChallenge(
+            challenge: "1234",
+            continuationToken: mfaRequiredState.continuationToken,
+            context: context,
+            scopes: mfaRequiredState.scopes,
+            claimsRequestJson: nil
+        )
+        return true
+    }
+}
@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <XCTest/XCTest.h>
+#import "MSALAccountSignInStateCache.h"
+
+@interface MSALAccountSignInStateCacheTests : XCTestCase
+
+@property (nonatomic) MSALAccountSignInStateCache *cache;
+
+@end
+
+@implementation MSALAccountSignInStateCacheTests
+
+- (void)setUp
+{
+    [super setUp];
+    self.cache = [MSALAccountSignInStateCache new];
+}
+
+- (void)testSignInState_whenNothingCached_shouldReturnUnknown
+{
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"], MSIDAccountMetadataStateUnknown);
+}
+
+- (void)testSignInState_whenStateSet_shouldReturnStateForSameClientIdOnly
+{
+    [self.cache setSignInState:MSIDAccountMetadataStateSignedOut forHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"];
+    
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"], MSIDAccountMetadataStateSignedOut);
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client2" keychainGroup:@"group"], MSIDAccountMetadataStateUnknown);
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid2.utid" clientId:@"client" keychainGroup:@"group"], MSIDAccountMetadataStateUnknown);
+}
+
+- (void)testSignInState_whenStateSetInOtherKeychainGroup_shouldReturnUnknown
+{
+    [self.cache setSignInState:MSIDAccountMetadataStateSignedOut forHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"];
+    
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group2"], MSIDAccountMetadataStateUnknown);
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:nil], MSIDAccountMetadataStateUnknown);
+}
+
+- (void)testSignInState_whenStateExpired_shouldReturnUnknown
+{
+    self.cache.stateLifetime = 0;
+    [self.cache setSignInState:MSIDAccountMetadataStateSignedOut forHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"];
+    
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"], MSIDAccountMetadataStateUnknown);
+}
+
+- (void)testRemoveSignInStates_shouldRemoveAccountInEveryKeychainGroupOfClient
+{
+    [self.cache setSignInState:MSIDAccountMetadataStateSignedOut forHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"];
+    [self.cache setSignInState:MSIDAccountMetadataStateSignedOut forHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group2"];
+    [self.cache setSignInState:MSIDAccountMetadataStateSignedOut forHomeAccountId:@"uid.utid" clientId:@"client2" keychainGroup:@"group"];
+    
+    [self.cache removeSignInStatesForHomeAccountId:@"uid.utid" clientId:@"client"];
+    
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"], MSIDAccountMetadataStateUnknown);
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group2"], MSIDAccountMetadataStateUnknown);
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client2" keychainGroup:@"group"], MSIDAccountMetadataStateSignedOut);
+}
+
+- (void)testSetSignInState_whenStateUpdated_shouldReturnLatestState
+{
+    [self.cache setSignInState:MSIDAccountMetadataStateSignedOut forHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"];
+    [self.cache setSignInState:MSIDAccountMetadataStateSignedIn forHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"];
+    
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"], MSIDAccountMetadataStateSignedIn);
+}
+
+- (void)testRemoveAllStates_shouldReturnUnknownForPreviouslyCachedAccounts
+{
+    [self.cache setSignInState:MSIDAccountMetadataStateSignedIn forHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"];
+    
+    [self.cache removeAllStates];
+    
+    XCTAssertEqual([self.cache signInStateForHomeAccountId:@"uid.utid" clientId:@"client" keychainGroup:@"group"], MSIDAccountMetadataStateUnknown);
+}
+
+@end
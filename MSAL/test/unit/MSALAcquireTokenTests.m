@@ -86,6 +86,8 @@
 #import "MSIDLRUCache.h"
 #import "MSIDFlightManager.h"
 #import "MSIDConstants.h"
+#import "MSALParameters+Internal.h"
+#import "MSALRequestCancellation.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
@@ -521,6 +523,43 @@
     [self waitForExpectations:@[expectation] timeout:5];
 }
 
+- (void)testAcquireTokenSilent_whenRequestCancelledBeforeStart_shouldReturnUserCanceledWithoutNetworkCall
+{
+    MSALAccountId *accountID = [[MSALAccountId alloc] initWithAccountIdentifier:DEFAULT_TEST_HOME_ACCOUNT_ID objectId:DEFAULT_TEST_UID tenantId:DEFAULT_TEST_UTID];
+    
+    MSALAccount *account = [[MSALAccount alloc] initWithUsername:@"preferredUserName"
+                                                   homeAccountId:accountID
+                                                     environment:@"login.microsoftonline.com"
+                                                  tenantProfiles:nil];
+    
+    NSError *error = nil;
+    MSALPublicClientApplication *application =
+    [[MSALPublicClientApplication alloc] initWithClientId:UNIT_TEST_CLIENT_ID
+                                                    error:&error];
+    XCTAssertNotNil(application);
+    application.tokenCache = self.tokenCache;
+    application.accountMetadataCache = self.accountMetadataCache;
+    
+    MSALSilentTokenParameters *params = [[MSALSilentTokenParameters alloc] initWithScopes:@[@"mail.read"]
+                                                                                  account:account];
+    params.cancellation = [MSALRequestCancellation new];
+    [params.cancellation cancel];
+    
+    // No network responses are registered, the request must complete without reaching the network
+    XCTestExpectation *expectation = [self expectationWithDescription:@"acquireTokenSilentWithParameters"];
+    [application acquireTokenSilentWithParameters:params
+                                  completionBlock:^(MSALResult *result, NSError *error)
+     {
+         XCTAssertNil(result);
+         XCTAssertNotNil(error);
+         XCTAssertEqualObjects(error.domain, MSALErrorDomain);
+         XCTAssertEqual(error.code, MSALErrorUserCanceled);
+         [expectation fulfill];
+     }];
+    
+    [self waitForExpectations:@[expectation] timeout:1];
+}
+
 - (void)testAcquireTokenSilent_whenNoATForScopeInCache_shouldUseRTAndReturnNewAT
 {
     NSString *authority = [NSString stringWithFormat:@"https://login.microsoftonline.com/%@", DEFAULT_TEST_UTID];
@@ -1532,6 +1571,158 @@
     [self waitForExpectations:@[expectation] timeout:1];
 }
 
+- (void)testAcquireTokenSilent_whenATInsideRefreshWindowAndStaleTokenAllowed_shouldReturnCachedToken
+{
+    // Seed a cache object with a user and an AT that is inside the default 300 seconds refresh window
+    NSMutableDictionary *json = [MSIDTestTokenResponse v2TokenResponseWithAT:DEFAULT_TEST_ACCESS_TOKEN
+                                                                          RT:@"i am a refresh token!"
+                                                                      scopes:[[NSOrderedSet alloc] initWithArray:@[@"user.read"]]
+                                                                     idToken:[MSIDTestIdTokenUtil defaultV2IdToken]
+                                                                         uid:DEFAULT_TEST_UID
+                                                                        utid:DEFAULT_TEST_UTID
+                                                                    familyId:nil].jsonDictionary.mutableCopy;
+    [json setValue:@"120" forKey:MSID_OAUTH2_EXPIRES_IN];
+
+    MSIDAADV2TokenResponse *response = [[MSIDAADV2TokenResponse alloc] initWithJSONDictionary:json error:nil];
+    
+    MSALAccountId *accountID = [[MSALAccountId alloc] initWithAccountIdentifier:DEFAULT_TEST_HOME_ACCOUNT_ID objectId:DEFAULT_TEST_UID tenantId:DEFAULT_TEST_UTID];
+    
+    MSALAccount *account = [[MSALAccount alloc] initWithUsername:@"preferredUserName"
+                                                   homeAccountId:accountID
+                                                     environment:@"login.microsoftonline.com"
+                                                  tenantProfiles:nil];
+
+    MSIDConfiguration *configuration = [MSIDTestConfiguration v2DefaultConfiguration];
+    configuration.clientId = UNIT_TEST_CLIENT_ID;
+    BOOL result = [self.tokenCache saveTokensWithConfiguration:configuration
+                                                      response:response
+                                                       factory:[MSIDAADV2Oauth2Factory new]
+                                                       context:nil
+                                                         error:nil];
+    XCTAssertTrue(result);
+
+    NSString *authority = [NSString stringWithFormat:@"https://login.microsoftonline.com/%@", DEFAULT_TEST_UTID];
+    MSIDTestURLResponse *discoveryResponse = [MSIDTestURLResponse discoveryResponseForAuthority:authority];
+    NSOrderedSet *expectedScopes = [NSOrderedSet orderedSetWithArray:@[@"user.read", @"openid", @"profile", @"offline_access"]];
+    
+    // Save account metadata authority map from common to the specific tenant id.
+    [self.accountMetadataCache updateAuthorityURL:[NSURL URLWithString:authority]
+                                    forRequestURL:[NSURL URLWithString:@"https://login.microsoftonline.com/common"] homeAccountId:accountID.identifier clientId:UNIT_TEST_CLIENT_ID instanceAware:NO context:nil error:nil];
+
+    MSIDTestURLResponse *tokenResponse = [MSIDTestURLResponse rtResponseForScopes:expectedScopes
+                                                                        authority:authority
+                                                                         tenantId:@"1234-5678-90abcdefg"
+                                                                              uid:@"1"
+                                                                             user:account
+                                                                           claims:nil];
+
+    [tokenResponse setResponseURL:@"https://someresponseurl.com" code:200 headerFields:@{}];
+
+    MSIDTestURLResponse *oidcResponse = [MSIDTestURLResponse oidcResponseForAuthority:authority];
+
+    [MSIDTestURLSession addResponses:@[discoveryResponse, oidcResponse, tokenResponse]];
+
+    NSError *error = nil;
+    MSALPublicClientApplication *application = [[MSALPublicClientApplication alloc] initWithClientId:UNIT_TEST_CLIENT_ID
+                                                                                               error:&error];
+    XCTAssertNotNil(application);
+    application.tokenCache = self.tokenCache;
+    application.accountMetadataCache = self.accountMetadataCache;
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"acquireTokenSilentWithParameters"];
+    MSALSilentTokenParameters *params = [[MSALSilentTokenParameters alloc] initWithScopes:@[@"user.read"]
+                                                                                  account:account];
+    params.allowStaleTokenWhileRevalidating = YES;
+    [application acquireTokenSilentWithParameters:params
+                                  completionBlock:^(MSALResult *result, NSError *error)
+     {
+         // Token is 180 seconds into the refresh window, below the default maximum staleness of 240 seconds
+         XCTAssertNil(error);
+         XCTAssertNotNil(result);
+         XCTAssertEqualObjects(result.accessToken, DEFAULT_TEST_ACCESS_TOKEN);
+
+         [expectation fulfill];
+     }];
+
+    [self waitForExpectations:@[expectation] timeout:1];
+}
+
+- (void)testAcquireTokenSilent_whenATInsideRefreshWindowBeyondMaximumStaleness_shouldRefreshToken
+{
+    // Seed a cache object with a user and an AT that is inside the default 300 seconds refresh window
+    NSMutableDictionary *json = [MSIDTestTokenResponse v2TokenResponseWithAT:DEFAULT_TEST_ACCESS_TOKEN
+                                                                          RT:@"i am a refresh token!"
+                                                                      scopes:[[NSOrderedSet alloc] initWithArray:@[@"user.read"]]
+                                                                     idToken:[MSIDTestIdTokenUtil defaultV2IdToken]
+                                                                         uid:DEFAULT_TEST_UID
+                                                                        utid:DEFAULT_TEST_UTID
+                                                                    familyId:nil].jsonDictionary.mutableCopy;
+    [json setValue:@"30" forKey:MSID_OAUTH2_EXPIRES_IN];
+
+    MSIDAADV2TokenResponse *response = [[MSIDAADV2TokenResponse alloc] initWithJSONDictionary:json error:nil];
+    
+    MSALAccountId *accountID = [[MSALAccountId alloc] initWithAccountIdentifier:DEFAULT_TEST_HOME_ACCOUNT_ID objectId:DEFAULT_TEST_UID tenantId:DEFAULT_TEST_UTID];
+    
+    MSALAccount *account = [[MSALAccount alloc] initWithUsername:@"preferredUserName"
+                                                   homeAccountId:accountID
+                                                     environment:@"login.microsoftonline.com"
+                                                  tenantProfiles:nil];
+
+    MSIDConfiguration *configuration = [MSIDTestConfiguration v2DefaultConfiguration];
+    configuration.clientId = UNIT_TEST_CLIENT_ID;
+    BOOL result = [self.tokenCache saveTokensWithConfiguration:configuration
+                                                      response:response
+                                                       factory:[MSIDAADV2Oauth2Factory new]
+                                                       context:nil
+                                                         error:nil];
+    XCTAssertTrue(result);
+
+    NSString *authority = [NSString stringWithFormat:@"https://login.microsoftonline.com/%@", DEFAULT_TEST_UTID];
+    MSIDTestURLResponse *discoveryResponse = [MSIDTestURLResponse discoveryResponseForAuthority:authority];
+    NSOrderedSet *expectedScopes = [NSOrderedSet orderedSetWithArray:@[@"user.read", @"openid", @"profile", @"offline_access"]];
+    
+    // Save account metadata authority map from common to the specific tenant id.
+    [self.accountMetadataCache updateAuthorityURL:[NSURL URLWithString:authority]
+                                    forRequestURL:[NSURL URLWithString:@"https://login.microsoftonline.com/common"] homeAccountId:accountID.identifier clientId:UNIT_TEST_CLIENT_ID instanceAware:NO context:nil error:nil];
+
+    MSIDTestURLResponse *tokenResponse = [MSIDTestURLResponse rtResponseForScopes:expectedScopes
+                                                                        authority:authority
+                                                                         tenantId:@"1234-5678-90abcdefg"
+                                                                              uid:@"1"
+                                                                             user:account
+                                                                           claims:nil];
+
+    [tokenResponse setResponseURL:@"https://someresponseurl.com" code:200 headerFields:@{}];
+
+    MSIDTestURLResponse *oidcResponse = [MSIDTestURLResponse oidcResponseForAuthority:authority];
+
+    [MSIDTestURLSession addResponses:@[discoveryResponse, oidcResponse, tokenResponse]];
+
+    NSError *error = nil;
+    MSALPublicClientApplication *application = [[MSALPublicClientApplication alloc] initWithClientId:UNIT_TEST_CLIENT_ID
+                                                                                               error:&error];
+    XCTAssertNotNil(application);
+    application.tokenCache = self.tokenCache;
+    application.accountMetadataCache = self.accountMetadataCache;
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"acquireTokenSilentWithParameters"];
+    MSALSilentTokenParameters *params = [[MSALSilentTokenParameters alloc] initWithScopes:@[@"user.read"]
+                                                                                  account:account];
+    params.allowStaleTokenWhileRevalidating = YES;
+    [application acquireTokenSilentWithParameters:params
+                                  completionBlock:^(MSALResult *result, NSError *error)
+     {
+         // Token is 270 seconds into the refresh window, above the default maximum staleness of 240 seconds
+         XCTAssertNil(error);
+         XCTAssertNotNil(result);
+         XCTAssertEqualObjects(result.accessToken, @"i am an updated access token!");
+
+         [expectation fulfill];
+     }];
+
+    [self waitForExpectations:@[expectation] timeout:1];
+}
+
 - (void)testAcquireTokenSilent_whenATAvailableAndExpired_andMixedCaseInputScope_shouldReturnToken
 {
     // Seed a cache object with a user and an AT
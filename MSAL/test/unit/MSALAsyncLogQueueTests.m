@@ -0,0 +1,237 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+#import <XCTest/XCTest.h>
+#import "MSALAsyncLogQueue.h"
+
+@interface MSALAsyncLogQueueTests : XCTestCase
+
+@end
+
+@implementation MSALAsyncLogQueueTests
+
+- (void)testEnqueue_shouldDeliverLogsInOrderOffCallingThread
+{
+    NSMutableArray *messages = [NSMutableArray new];
+    NSThread *callingThread = [NSThread currentThread];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Logs delivered"];
+    
+    MSALAsyncLogQueue *queue = [[MSALAsyncLogQueue alloc] initWithCapacity:64 overflowPolicy:MSALLogOverflowPolicyDropNewest callback:^(MSALLogLevel level, NSString *message, BOOL containsPII) {
+        XCTAssertNotEqualObjects([NSThread currentThread], callingThread);
+        XCTAssertEqual(level, MSALLogLevelInfo);
+        XCTAssertTrue(containsPII);
+        
+        [messages addObject:message];
+        if (messages.count == 10) [expectation fulfill];
+    }];
+    
+    for (NSUInteger i = 0; i < 10; i++)
+    {
+        [queue enqueueLogWithLevel:MSALLogLevelInfo message:@(i).stringValue containsPII:YES];
+    }
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    XCTAssertEqualObjects(messages, (@[@"0", @"1", @"2", @"3", @"4", @"5", @"6", @"7", @"8", @"9"]));
+    XCTAssertEqual(queue.droppedLogCount, 0);
+}
+
+- (void)testEnqueue_whenQueueIsFullAndDropNewest_shouldKeepOldestLogs
+{
+    dispatch_semaphore_t callbackBlocked = dispatch_semaphore_create(0);
+    dispatch_semaphore_t releaseCallback = dispatch_semaphore_create(0);
+    NSMutableArray *messages = [NSMutableArray new];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Logs delivered"];
+    
+    MSALAsyncLogQueue *queue = [[MSALAsyncLogQueue alloc] initWithCapacity:4 overflowPolicy:MSALLogOverflowPolicyDropNewest callback:^(__unused MSALLogLevel level, NSString *message, __unused BOOL containsPII) {
+        if ([message isEqualToString:@"blocking"])
+        {
+            dispatch_semaphore_signal(callbackBlocked);
+            dispatch_semaphore_wait(releaseCallback, DISPATCH_TIME_FOREVER);
+            return;
+        }
+        
+        [messages addObject:message];
+        if (messages.count == 4) [expectation fulfill];
+    }];
+    
+    [queue enqueueLogWithLevel:MSALLogLevelInfo message:@"blocking" containsPII:NO];
+    dispatch_semaphore_wait(callbackBlocked, DISPATCH_TIME_FOREVER);
+    
+    for (NSUInteger i = 0; i < 6; i++)
+    {
+        [queue enqueueLogWithLevel:MSALLogLevelInfo message:@(i).stringValue containsPII:NO];
+    }
+    
+    XCTAssertEqual(queue.droppedLogCount, 2);
+    
+    dispatch_semaphore_signal(releaseCallback);
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    XCTAssertEqualObjects(messages, (@[@"0", @"1", @"2", @"3"]));
+}
+
+- (void)testEnqueue_whenQueueIsFullAndDropOldest_shouldKeepNewestLogs
+{
+    dispatch_semaphore_t callbackBlocked = dispatch_semaphore_create(0);
+    dispatch_semaphore_t releaseCallback = dispatch_semaphore_create(0);
+    NSMutableArray *messages = [NSMutableArray new];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Logs delivered"];
+    
+    MSALAsyncLogQueue *queue = [[MSALAsyncLogQueue alloc] initWithCapacity:4 overflowPolicy:MSALLogOverflowPolicyDropOldest callback:^(__unused MSALLogLevel level, NSString *message, __unused BOOL containsPII) {
+        if ([message isEqualToString:@"blocking"])
+        {
+            dispatch_semaphore_signal(callbackBlocked);
+            dispatch_semaphore_wait(releaseCallback, DISPATCH_TIME_FOREVER);
+            return;
+        }
+        
+        [messages addObject:message];
+        if (messages.count == 4) [expectation fulfill];
+    }];
+    
+    [queue enqueueLogWithLevel:MSALLogLevelInfo message:@"blocking" containsPII:NO];
+    dispatch_semaphore_wait(callbackBlocked, DISPATCH_TIME_FOREVER);
+    
+    for (NSUInteger i = 0; i < 6; i++)
+    {
+        [queue enqueueLogWithLevel:MSALLogLevelInfo message:@(i).stringValue containsPII:NO];
+    }
+    
+    XCTAssertEqual(queue.droppedLogCount, 2);
+    
+    dispatch_semaphore_signal(releaseCallback);
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    XCTAssertEqualObjects(messages, (@[@"2", @"3", @"4", @"5"]));
+}
+
+- (void)testFlush_whenCalledFromManyProducers_shouldDeliverEveryLogOnce
+{
+    NSMutableSet *messages = [NSMutableSet new];
+    __block NSUInteger deliveredCount = 0;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Logs delivered"];
+    
+    MSALAsyncLogQueue *queue = [[MSALAsyncLogQueue alloc] initWithCapacity:8192 overflowPolicy:MSALLogOverflowPolicyDropNewest callback:^(__unused MSALLogLevel level, NSString *message, __unused BOOL containsPII) {
+        [messages addObject:message];
+        if (++deliveredCount == 4000) [expectation fulfill];
+    }];
+    
+    dispatch_apply(8, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+        for (NSUInteger i = 0; i < 500; i++)
+        {
+            [queue enqueueLogWithLevel:MSALLogLevelVerbose message:[NSString stringWithFormat:@"%zu-%lu", thread, (unsigned long)i] containsPII:NO];
+        }
+    });
+    
+    [queue flush];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    
+    XCTAssertEqual(deliveredCount, 4000);
+    XCTAssertEqual(messages.count, 4000);
+    XCTAssertEqual(queue.droppedLogCount, 0);
+}
+
+- (void)testFlush_whenCalledFromCallback_shouldDeliverWithoutDeadlock
+{
+    NSMutableArray *messages = [NSMutableArray new];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Logs delivered"];
+    __block MSALAsyncLogQueue *queue;
+    
+    queue = [[MSALAsyncLogQueue alloc] initWithCapacity:8 overflowPolicy:MSALLogOverflowPolicyDropNewest callback:^(__unused MSALLogLevel level, NSString *message, __unused BOOL containsPII) {
+        [messages addObject:message];
+        if ([message isEqualToString:@"flushing"]) [queue flush];
+        if (messages.count == 2) [expectation fulfill];
+    }];
+    
+    [queue enqueueLogWithLevel:MSALLogLevelInfo message:@"flushing" containsPII:NO];
+    [queue enqueueLogWithLevel:MSALLogLevelInfo message:@"after" containsPII:NO];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    XCTAssertEqualObjects(messages, (@[@"flushing", @"after"]));
+}
+
+- (void)testFlush_whenConsumerIsDelivering_shouldReturnAfterAllLogsAreDeliveredInOrder
+{
+    dispatch_semaphore_t callbackBlocked = dispatch_semaphore_create(0);
+    dispatch_semaphore_t releaseCallback = dispatch_semaphore_create(0);
+    NSMutableArray *messages = [NSMutableArray new];
+    
+    MSALAsyncLogQueue *queue = [[MSALAsyncLogQueue alloc] initWithCapacity:8 overflowPolicy:MSALLogOverflowPolicyDropNewest callback:^(__unused MSALLogLevel level, NSString *message, __unused BOOL containsPII) {
+        if ([message isEqualToString:@"blocking"])
+        {
+            dispatch_semaphore_signal(callbackBlocked);
+            dispatch_semaphore_wait(releaseCallback, DISPATCH_TIME_FOREVER);
+        }
+        
+        [messages addObject:message];
+    }];
+    
+    [queue enqueueLogWithLevel:MSALLogLevelInfo message:@"blocking" containsPII:NO];
+    dispatch_semaphore_wait(callbackBlocked, DISPATCH_TIME_FOREVER);
+    [queue enqueueLogWithLevel:MSALLogLevelInfo message:@"0" containsPII:NO];
+    [queue enqueueLogWithLevel:MSALLogLevelInfo message:@"1" containsPII:NO];
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.1 * NSEC_PER_SEC)), dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+        dispatch_semaphore_signal(releaseCallback);
+    });
+    
+    [queue flush];
+    
+    XCTAssertEqualObjects(messages, (@[@"blocking", @"0", @"1"]));
+}
+
+- (void)testFlush_whenCallbackIsBlocked_shouldReturnAfterTimeoutWithoutCallingCallback
+{
+    dispatch_semaphore_t callbackBlocked = dispatch_semaphore_create(0);
+    dispatch_semaphore_t releaseCallback = dispatch_semaphore_create(0);
+    NSMutableArray *messages = [NSMutableArray new];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Logs delivered"];
+    
+    MSALAsyncLogQueue *queue = [[MSALAsyncLogQueue alloc] initWithCapacity:8 overflowPolicy:MSALLogOverflowPolicyDropNewest callback:^(__unused MSALLogLevel level, NSString *message, __unused BOOL containsPII) {
+        if ([message isEqualToString:@"blocking"])
+        {
+            dispatch_semaphore_signal(callbackBlocked);
+            dispatch_semaphore_wait(releaseCallback, DISPATCH_TIME_FOREVER);
+            return;
+        }
+        
+        [messages addObject:message];
+        [expectation fulfill];
+    }];
+    queue.flushTimeout = 0.1;
+    
+    [queue enqueueLogWithLevel:MSALLogLevelInfo message:@"blocking" containsPII:NO];
+    dispatch_semaphore_wait(callbackBlocked, DISPATCH_TIME_FOREVER);
+    [queue enqueueLogWithLevel:MSALLogLevelInfo message:@"0" containsPII:NO];
+    
+    [queue flush];
+    
+    XCTAssertEqualObjects(messages, @[]);
+    dispatch_semaphore_signal(releaseCallback);
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    XCTAssertEqualObjects(messages, (@[@"0"]));
+}
+
+@end
@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <XCTest/XCTest.h>
+#import "MSALDevicePopManager.h"
+#import "MSALDevicePopManagerUtil.h"
+#import "MSALAuthenticationSchemePop+Internal.h"
+#import "MSALAuthenticationSchemeProtocolInternal.h"
+#import "MSIDAssymetricKeyPair.h"
+#import "MSIDAccessToken.h"
+#import "MSIDOAuth2Constants.h"
+
+static const NSUInteger MSALPopSigningIterations = 200;
+
+@interface MSALDevicePopManagerTests : XCTestCase
+
+@property (nonatomic) MSALDevicePopManager *popManager;
+
+@end
+
+@implementation MSALDevicePopManagerTests
+
+- (void)setUp
+{
+    [super setUp];
+    self.popManager = [MSALDevicePopManagerUtil test_initCachingPopManagerWithValidCacheConfig];
+}
+
+- (void)testKeyMaterial_whenCalledTwice_shouldReturnSameCachedInstance
+{
+    MSALPopKeyMaterial *keyMaterial = [self.popManager keyMaterial];
+    
+    XCTAssertNotNil(keyMaterial);
+    XCTAssertEqual(keyMaterial, [self.popManager keyMaterial]);
+    XCTAssertEqual(keyMaterial.keyPair, self.popManager.keyPair);
+    XCTAssertEqualObjects(keyMaterial.jsonWebKey, keyMaterial.keyPair.jsonWebKey);
+    XCTAssertEqualObjects(keyMaterial.thumbprint, keyMaterial.keyPair.kid);
+    XCTAssertTrue(keyMaterial.privateKeyRef != NULL);
+}
+
+- (void)testKeyMaterial_whenInvalidated_shouldReloadSameKeyFromKeychain
+{
+    MSALPopKeyMaterial *keyMaterial = [self.popManager keyMaterial];
+    
+    [self.popManager invalidateKeyMaterial];
+    MSALPopKeyMaterial *reloadedKeyMaterial = [self.popManager keyMaterial];
+    
+    XCTAssertNotNil(reloadedKeyMaterial);
+    XCTAssertNotEqual(keyMaterial, reloadedKeyMaterial);
+    XCTAssertEqualObjects(keyMaterial.thumbprint, reloadedKeyMaterial.thumbprint);
+}
+
+- (void)testKeyMaterial_whenValidationIntervalElapsedAndKeyNotRotated_shouldKeepCachedInstance
+{
+    self.popManager.keyValidationInterval = 0;
+    MSALPopKeyMaterial *keyMaterial = [self.popManager keyMaterial];
+    
+    XCTAssertEqual(keyMaterial, [self.popManager keyMaterial]);
+}
+
+- (void)testGetSchemeParameters_withCachingPopManager_shouldUseCachedJsonWebKey
+{
+    MSALAuthenticationSchemePop *authScheme = [self popAuthScheme];
+    
+    NSDictionary *schemeParams = [authScheme getSchemeParameters:self.popManager];
+    
+    XCTAssertEqualObjects(schemeParams[MSID_OAUTH2_TOKEN_TYPE], @"Pop");
+    XCTAssertEqualObjects(schemeParams[MSID_OAUTH2_REQUEST_CONFIRMATION], [self.popManager keyMaterial].jsonWebKey);
+}
+
+- (void)testGetClientAccessToken_withCachingPopManager_shouldReturnSignedToken
+{
+    MSALAuthenticationSchemePop *authScheme = [self popAuthScheme];
+    NSError *error;
+    
+    NSString *signedAccessToken = [authScheme getClientAccessToken:[self accessToken] popManager:self.popManager error:&error];
+    
+    XCTAssertNotNil(signedAccessToken);
+    XCTAssertNil(error);
+}
+
+#pragma mark - Performance
+
+- (void)testSigningThroughput_with1Thread
+{
+    [self measureSigningThroughputWithThreadCount:1];
+}
+
+- (void)testSigningThroughput_with4Threads
+{
+    [self measureSigningThroughputWithThreadCount:4];
+}
+
+- (void)testSigningThroughput_with8Threads
+{
+    [self measureSigningThroughputWithThreadCount:8];
+}
+
+#pragma mark - Helpers
+
+- (void)measureSigningThroughputWithThreadCount:(NSUInteger)threadCount
+{
+    MSALAuthenticationSchemePop *authScheme = [self popAuthScheme];
+    MSIDAccessToken *accessToken = [self accessToken];
+    MSALDevicePopManager *popManager = self.popManager;
+    NSUInteger iterationsPerThread = MSALPopSigningIterations / threadCount;
+    
+    // Warm up the key material so that only signing is measured.
+    XCTAssertNotNil([popManager keyMaterial]);
+    
+    [self measureBlock:^{
+        dispatch_group_t group = dispatch_group_create();
+        dispatch_queue_t queue = dispatch_queue_create("com.microsoft.msal.tests.popsigning", DISPATCH_QUEUE_CONCURRENT);
+        __block NSUInteger failures = 0;
+        
+        for (NSUInteger thread = 0; thread < threadCount; thread++)
+        {
+            dispatch_group_async(group, queue, ^{
+                for (NSUInteger i = 0; i < iterationsPerThread; i++)
+                {
+                    if (![authScheme getClientAccessToken:accessToken popManager:popManager error:nil])
+                    {
+                        @synchronized (self) { failures++; }
+                    }
+                }
+            });
+        }
+        
+        dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+        XCTAssertEqual(failures, 0);
+    }];
+}
+
+- (MSALAuthenticationSchemePop *)popAuthScheme
+{
+    NSURL *requestUrl = [NSURL URLWithString:@"https://signedhttprequest.azurewebsites.net/api/validateSHR"];
+    return [[MSALAuthenticationSchemePop alloc] initWithHttpMethod:MSALHttpMethodPOST requestUrl:requestUrl nonce:nil additionalParameters:nil];
+}
+
+- (MSIDAccessToken *)accessToken
+{
+    MSIDAccessToken *token = [MSIDAccessToken new];
+    token.accessToken = @"token";
+    return token;
+}
+
+@end
@@ -656,4 +656,241 @@
     XCTAssertNil(msalError.userInfo[MSALInternalErrorCodeKey]);
 }
 
+#pragma mark - Mapping table parity
+
+- (void)testErrorConversion_forEveryMSIDErrorCode_shouldMatchLegacyDictionaryMapping
+{
+    NSDictionary *legacyMapping = [self legacyErrorCodeMapping];
+    NSMutableSet *codes = [NSMutableSet setWithArray:legacyMapping.allKeys];
+    for (NSArray *domainCodes in MSIDErrorDomainsAndCodes().allValues)
+    {
+        [codes addObjectsFromArray:domainCodes];
+    }
+    
+    // Codes outside of the table must still fall back to MSALErrorInternal
+    [codes addObjectsFromArray:@[@0, @1, @-1, @123456, @(NSIntegerMax), @(NSIntegerMin)]];
+    
+    for (NSString *domain in @[MSIDErrorDomain, MSIDOAuthErrorDomain, MSIDHttpErrorCodeDomain])
+    {
+        for (NSNumber *code in codes)
+        {
+            NSNumber *expectedCode = legacyMapping[code] ?: @(MSALErrorInternal);
+            
+            NSError *unclassifiedError = [self convertErrorWithDomain:domain code:code.integerValue userInfo:nil classifyErrors:NO];
+            XCTAssertEqualObjects(unclassifiedError.domain, MSALErrorDomain);
+            XCTAssertEqual(unclassifiedError.code, expectedCode.integerValue, @"Mismatch for %@ code %@", domain, code);
+            XCTAssertNil(unclassifiedError.userInfo[MSALInternalErrorCodeKey]);
+            
+            NSError *classifiedError = [self convertErrorWithDomain:domain code:code.integerValue userInfo:nil classifyErrors:YES];
+            if ([[self legacyRecoverableErrorCodes] containsObject:expectedCode])
+            {
+                XCTAssertEqual(classifiedError.code, expectedCode.integerValue);
+                XCTAssertNil(classifiedError.userInfo[MSALInternalErrorCodeKey]);
+            }
+            else
+            {
+                NSNumber *expectedInternalCode = expectedCode.integerValue == MSALErrorInternal ? @(MSALInternalErrorUnexpected) : expectedCode;
+                XCTAssertEqual(classifiedError.code, MSALErrorInternal);
+                XCTAssertEqualObjects(classifiedError.userInfo[MSALInternalErrorCodeKey], expectedInternalCode, @"Mismatch for %@ code %@", domain, code);
+            }
+        }
+    }
+}
+
+- (void)testErrorConversion_whenKeychainDomain_shouldMapToOSStatusDomainAndKeepCode
+{
+    NSError *error = [self convertErrorWithDomain:MSIDKeychainErrorDomain code:-25300 userInfo:nil classifyErrors:YES];
+    
+    XCTAssertEqualObjects(error.domain, NSOSStatusErrorDomain);
+    XCTAssertEqual(error.code, -25300);
+    XCTAssertNil(error.userInfo[MSALInternalErrorCodeKey]);
+}
+
+- (void)testErrorConversion_whenUserInfoHasAllMSIDKeys_shouldRenameEachKeyAndKeepOthers
+{
+    NSDictionary *legacyKeyMapping = @{MSIDHTTPHeadersKey : MSALHTTPHeadersKey,
+                                       MSIDHTTPResponseCodeKey : MSALHTTPResponseCodeKey,
+                                       MSIDCorrelationIdKey : MSALCorrelationIDKey,
+                                       MSIDErrorDescriptionKey : MSALErrorDescriptionKey,
+                                       MSIDSTSErrorCodesKey : MSALSTSErrorCodesKey,
+                                       MSIDOAuthErrorKey: MSALOAuthErrorKey,
+                                       MSIDOAuthSubErrorKey: MSALOAuthSubErrorKey,
+                                       MSIDOAuthSubErrorDescriptionKey: MSALOAuthSubErrorDescriptionKey,
+                                       MSIDDeclinedScopesKey: MSALDeclinedScopesKey,
+                                       MSIDGrantedScopesKey: MSALGrantedScopesKey,
+                                       MSIDUserDisplayableIdkey: MSALDisplayableUserIdKey,
+                                       MSIDBrokerVersionKey: MSALBrokerVersionKey,
+                                       MSIDHomeAccountIdkey: MSALHomeAccountIdKey,
+                                       MSIDThrottlingCacheHitKey: MSALThrottlingCacheHitKey};
+    
+    NSMutableDictionary *userInfo = [NSMutableDictionary new];
+    for (NSString *key in legacyKeyMapping)
+    {
+        userInfo[key] = [NSString stringWithFormat:@"value for %@", key];
+    }
+    userInfo[@"custom_key"] = @"custom_value";
+    
+    NSError *error = [self convertErrorWithDomain:MSIDErrorDomain code:MSIDErrorInteractionRequired userInfo:userInfo classifyErrors:YES];
+    
+    for (NSString *key in legacyKeyMapping)
+    {
+        XCTAssertEqualObjects(error.userInfo[legacyKeyMapping[key]], userInfo[key]);
+        if (![key isEqualToString:legacyKeyMapping[key]])
+        {
+            XCTAssertNil(error.userInfo[key]);
+        }
+    }
+    XCTAssertEqualObjects(error.userInfo[@"custom_key"], @"custom_value");
+    XCTAssertEqual(error.userInfo.count, legacyKeyMapping.count + 1);
+}
+
+- (void)testErrorConversion_performanceOfOneMillionMixedErrors
+{
+    NSArray<NSError *> *errors = @[MSIDCreateError(MSIDErrorDomain, MSIDErrorInteractionRequired, @"Interaction required", @"interaction_required", nil, nil, nil, @{MSIDHTTPResponseCodeKey : @400}, NO),
+                                   MSIDCreateError(MSIDOAuthErrorDomain, MSIDErrorServerInvalidGrant, @"Invalid grant", @"invalid_grant", @"bad_token", nil, nil, nil, NO),
+                                   MSIDCreateError(MSIDErrorDomain, MSIDErrorUserCancel, @"User cancelled", nil, nil, nil, nil, nil, NO),
+                                   MSIDCreateError(MSIDErrorDomain, MSIDErrorBrokerKeyNotFound, @"Broker key not found", nil, nil, nil, nil, nil, NO),
+                                   MSIDCreateError(MSIDHttpErrorCodeDomain, MSIDErrorServerUnhandledResponse, @"Unhandled", nil, nil, nil, nil, nil, NO),
+                                   MSIDCreateError(MSIDKeychainErrorDomain, -25300, @"Item not found", nil, nil, nil, nil, nil, NO),
+                                   MSIDCreateError(MSIDErrorDomain, 123456, @"Unmapped", nil, nil, nil, nil, nil, NO)];
+    
+    XCTMeasureOptions *options = [XCTMeasureOptions defaultOptions];
+    options.iterationCount = 1;
+    
+    [self measureWithOptions:options block:^{
+        for (NSUInteger i = 0; i < 1000000; i++)
+        {
+            @autoreleasepool
+            {
+                [MSALErrorConverter msalErrorFromMsidError:errors[i % errors.count]];
+            }
+        }
+    }];
+}
+
+#pragma mark - Helpers
+
+- (NSError *)convertErrorWithDomain:(NSString *)domain
+                               code:(NSInteger)code
+                           userInfo:(NSDictionary *)userInfo
+                     classifyErrors:(BOOL)classifyErrors
+{
+    return [MSALErrorConverter errorWithDomain:domain
+                                          code:code
+                              errorDescription:nil
+                                    oauthError:nil
+                                      subError:nil
+                               underlyingError:nil
+                                 correlationId:nil
+                                      userInfo:userInfo
+                                classifyErrors:classifyErrors
+                            msalOauth2Provider:nil
+                                    authScheme:[MSALAuthenticationSchemeBearer new]
+                                    popManager:nil];
+}
+
+- (NSSet<NSNumber *> *)legacyRecoverableErrorCodes
+{
+    return [NSSet setWithObjects:@(MSALErrorWorkplaceJoinRequired), @(MSALErrorInteractionRequired), @(MSALErrorServerDeclinedScopes), @(MSALErrorServerProtectionPoliciesRequired), @(MSALErrorUserCanceled), @(MSALErrorServerInvalidRequestResetPasswordRequired), nil];
+}
+
+// Dictionary based mapping used by MSALErrorConverter before the flat table, kept as the parity reference.
+- (NSDictionary<NSNumber *, NSNumber *> *)legacyErrorCodeMapping
+{
+    return @{
+        // General
+        @(MSIDErrorInternal) : @(MSALErrorInternal),
+        @(MSIDErrorInvalidInternalParameter) : @(MSALErrorInternal),
+        @(MSIDErrorInvalidDeveloperParameter) : @(MSALInternalErrorInvalidParameter),
+        @(MSIDErrorUnsupportedFunctionality) : @(MSALErrorInternal),
+        @(MSIDErrorMissingAccountParameter) : @(MSALInternalErrorAccountRequired),
+        @(MSIDErrorInteractionRequired) : @(MSALErrorInteractionRequired),
+        @(MSIDErrorServerNonHttpsRedirect) : @(MSALInternalErrorNonHttpsRedirect),
+        @(MSIDErrorMismatchedAccount) : @(MSALInternalErrorMismatchedUser),
+        @(MSIDErrorRedirectSchemeNotRegistered) : @(MSALInternalErrorRedirectSchemeNotRegistered),
+        @(MSIDErrorInvalidRedirectURI) : @(MSALInternalErrorInvalidRedirectURI),
+        // Cache
+        @(MSIDErrorCacheMultipleUsers) : @(MSALInternalErrorAmbiguousAccount),
+        @(MSIDErrorCacheBadFormat) : @(MSALErrorInternal),
+        // Authority Validation
+        @(MSIDErrorAuthorityValidation) : @(MSALInternalErrorFailedAuthorityValidation),
+        // Interactive flow
+        @(MSIDErrorAuthorizationFailed) : @(MSALInternalErrorAuthorizationFailed),
+        @(MSIDErrorUserCancel) : @(MSALErrorUserCanceled),
+        @(MSIDErrorSessionCanceledProgrammatically) : @(MSALErrorUserCanceled),
+        @(MSIDErrorInteractiveSessionStartFailure) : @(MSALErrorInternal),
+        @(MSIDErrorInteractiveSessionAlreadyRunning) : @(MSALInternalErrorInteractiveSessionAlreadyRunning),
+        @(MSIDErrorNoMainViewController) : @(MSALInternalErrorNoViewController),
+        @(MSIDErrorAttemptToOpenURLFromExtension) : @(MSALInternalErrorAttemptToOpenURLFromExtension),
+        @(MSIDErrorUINotSupportedInExtension) : @(MSALInternalErrorUINotSupportedInExtension),
+        @(MSIDErrorInsufficientDeviceStrength) : @(MSALErrorInsufficientDeviceStrength),
+        @(MSIDErrorMDMEnrollmentCompletedNeedsRetry) : @(MSALErrorMDMEnrollmentCompletedNeedsRetry),
+        @(MSIDErrorInvalidASWebAuthenticationURL) : @(MSALInternalErrorInvalidASWebAuthenticationURL),
+        // Broker errors
+        @(MSIDErrorBrokerResponseNotReceived) : @(MSALInternalErrorBrokerResponseNotReceived),
+        @(MSIDErrorBrokerNoResumeStateFound) : @(MSALInternalErrorBrokerNoResumeStateFound),
+        @(MSIDErrorBrokerBadResumeStateFound) : @(MSALInternalErrorBrokerBadResumeStateFound),
+        @(MSIDErrorBrokerMismatchedResumeState) : @(MSALInternalErrorBrokerMismatchedResumeState),
+        @(MSIDErrorBrokerResponseHashMissing) : @(MSALInternalErrorBrokerResponseHashMissing),
+        @(MSIDErrorBrokerCorruptedResponse) : @(MSALInternalErrorBrokerCorruptedResponse),
+        @(MSIDErrorBrokerResponseDecryptionFailed) : @(MSALInternalErrorBrokerResponseDecryptionFailed),
+        @(MSIDErrorBrokerResponseHashMismatch) : @(MSALInternalErrorBrokerResponseHashMismatch),
+        @(MSIDErrorBrokerKeyFailedToCreate) : @(MSALInternalErrorBrokerKeyFailedToCreate),
+        @(MSIDErrorBrokerKeyNotFound) : @(MSALInternalErrorBrokerKeyNotFound),
+        @(MSIDErrorWorkplaceJoinRequired) : @(MSALErrorWorkplaceJoinRequired),
+        @(MSIDErrorBrokerUnknown) : @(MSALInternalErrorBrokerUnknown),
+        @(MSIDErrorBrokerApplicationTokenReadFailed) : @(MSALInternalErrorBrokerApplicationTokenReadFailed),
+        @(MSIDErrorBrokerApplicationTokenWriteFailed) : @(MSALInternalErrorBrokerApplicationTokenWriteFailed),
+        @(MSIDErrorBrokerNotAvailable) : @(MSALInternalBrokerNotAvailable),
+        @(MSIDErrorJITLinkServerConfirmationError) : @(MSALInternalErrorJITLinkServerConfirmationError),
+        @(MSIDErrorJITLinkAcquireTokenError) : @(MSALInternalErrorJITLinkAcquireTokenError),
+        @(MSIDErrorJITLinkTokenAcquiredWrongTenant) : @(MSALInternalErrorJITLinkTokenAcquiredWrongTenant),
+        @(MSIDErrorJITLinkError) : @(MSALInternalErrorJITLinkError),
+        @(MSIDErrorJITComplianceCheckResultNotCompliant) : @(MSALInternalErrorJITComplianceCheckResultNotCompliant),
+        @(MSIDErrorJITComplianceCheckResultTimeout) : @(MSALInternalErrorJITComplianceCheckResultTimeout),
+        @(MSIDErrorJITComplianceCheckResultUnknown) : @(MSALInternalErrorJITComplianceCheckResultUnknown),
+        @(MSIDErrorJITComplianceCheckInvalidLinkPayload) : @(MSALErrorJITComplianceCheckInvalidLinkPayload),
+        @(MSIDErrorJITComplianceCheckCreateController) : @(MSALErrorJITComplianceCheckCreateController),
+        @(MSIDErrorJITLinkConfigNotFound) : @(MSALErrorJITLinkConfigNotFound),
+        @(MSIDErrorJITInvalidLinkTokenConfig) : @(MSALErrorJITInvalidLinkTokenConfig),
+        @(MSIDErrorJITWPJDeviceRegistrationFailed) : @(MSALErrorJITWPJDeviceRegistrationFailed),
+        @(MSIDErrorJITWPJAccountIdentifierNil) : @(MSALErrorJITWPJAccountIdentifierNil),
+        @(MSIDErrorJITWPJAcquireTokenError) : @(MSALErrorJITWPJAcquireTokenError),
+        @(MSIDErrorJITRetryRequired) : @(MSALErrorJITRetryRequired),
+        @(MSIDErrorJITUnknownStatusWebCP) : @(MSALErrorJITUnknownStatusWebCP),
+        @(MSIDErrorJITTroubleshootingRequired) : @(MSALErrorJITTroubleshootingRequired),
+        @(MSIDErrorJITTroubleshootingCreateController) : @(MSALErrorJITTroubleshootingCreateController),
+        @(MSIDErrorJITTroubleshootingResultUnknown) : @(MSALErrorJITTroubleshootingResultUnknown),
+        @(MSIDErrorJITTroubleshootingAcquireToken) : @(MSALErrorJITTroubleshootingAcquireToken),
+        @(MSIDErrorDeviceNotPSSORegistered) : @(MSALErrorDeviceNotPSSORegistered),
+        @(MSIDErrorPSSOKeyIdMismatch) : @(MSALErrorPSSOKeyIdMismatch),
+        @(MSIDErrorJITErrorHandlingConfigNotFound) : @(MSALErrorJITErrorHandlingConfigNotFound),
+        @(MSIDErrorPSSOBiometricPolicyMismatch) : @(MSALErrorPSSOBiometricPolicyMismatch),
+        @(MSIDErrorPSSOInvalidPasskeyExtension) : @(MSALErrorPSSOInvalidPasskeyExtension),
+        @(MSIDErrorPSSOSaveLoginConfigFailure) : @(MSALErrorPSSOSaveLoginConfigFailure),
+        @(MSIDErrorPSSOPasskeyLAError) : @(MSALErrorPSSOPasskeyLAError),
+        @(MSIDErrorPSSOBiometricsNotAvailable) : @(MSALErrorPSSOBiometricsNotAvailable),
+        @(MSIDErrorPSSOBiometricsNotEnrolled) : @(MSALErrorPSSOBiometricsNotEnrolled),
+        // Oauth2 errors
+        @(MSIDErrorServerOauth) : @(MSALInternalErrorAuthorizationFailed),
+        @(MSIDErrorServerInvalidResponse) : @(MSALInternalErrorInvalidResponse),
+        // We don't support this error code in MSAL. This error
+        // exists specifically for ADAL.
+        @(MSIDErrorServerRefreshTokenRejected) : @(MSALErrorInternal),
+        @(MSIDErrorServerInvalidRequest) : @(MSALInternalErrorInvalidRequest),
+        @(MSIDErrorServerInvalidClient) : @(MSALInternalErrorInvalidClient),
+        @(MSIDErrorServerInvalidGrant) : @(MSALInternalErrorInvalidGrant),
+        @(MSIDErrorServerInvalidScope) : @(MSALInternalErrorInvalidScope),
+        @(MSIDErrorServerUnauthorizedClient) : @(MSALInternalErrorUnauthorizedClient),
+        @(MSIDErrorServerAccessDenied) : @(MSALErrorUserCanceled),
+        @(MSIDErrorServerDeclinedScopes) : @(MSALErrorServerDeclinedScopes),
+        @(MSIDErrorServerError) : @(MSALErrorServerError),
+        @(MSIDErrorServerInvalidState) : @(MSALInternalErrorInvalidState),
+        @(MSIDErrorServerProtectionPoliciesRequired) : @(MSALErrorServerProtectionPoliciesRequired),
+        @(MSIDErrorServerUnhandledResponse) : @(MSALInternalErrorUnhandledResponse),
+        @(MSIDErrorUnexpectedHttpResponse) : @(MSALInternalErrorUnexpectedHttpResponse),
+        @(MSIDErrorServerInvalidRequestResetPasswordRequired) : @(MSALErrorServerInvalidRequestResetPasswordRequired)
+    };
+}
+
 @end
@@ -0,0 +1,129 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <XCTest/XCTest.h>
+#import "MSALMetricsRegistry.h"
+#import "MSALGlobalConfig.h"
+#import "MSALTelemetryConfig.h"
+
+@interface MSALMetricsRegistryTests : XCTestCase
+
+@end
+
+@implementation MSALMetricsRegistryTests
+
+- (void)testIncrementCounter_shouldOnlyIncrementThatCounter
+{
+    MSALMetricsRegistry *registry = [MSALMetricsRegistry new];
+    
+    [registry incrementCounter:MSALMetricsCounterCacheHit];
+    [registry incrementCounter:MSALMetricsCounterCacheHit];
+    [registry incrementCounter:MSALMetricsCounterNativeAuthHttpRetry];
+    
+    MSALMetricsSnapshot snapshot = [registry snapshot];
+    XCTAssertEqual(snapshot.cacheHits, 2);
+    XCTAssertEqual(snapshot.cacheMisses, 0);
+    XCTAssertEqual(snapshot.nativeAuthHttpRetries, 1);
+}
+
+- (void)testRecordLatency_shouldFillBucketsCountTotalAndMax
+{
+    MSALMetricsRegistry *registry = [MSALMetricsRegistry new];
+    
+    [registry recordLatencyMicroseconds:500 histogram:MSALMetricsHistogramSilentTokenLatency];
+    [registry recordLatencyMicroseconds:1000 histogram:MSALMetricsHistogramSilentTokenLatency];
+    [registry recordLatencyMicroseconds:30000 histogram:MSALMetricsHistogramSilentTokenLatency];
+    [registry recordLatencyMicroseconds:60000000 histogram:MSALMetricsHistogramSilentTokenLatency];
+    
+    MSALHistogramSnapshot histogram = [registry snapshot].silentTokenLatency;
+    XCTAssertEqual(histogram.count, 4);
+    XCTAssertEqual(histogram.totalMicroseconds, 60031500);
+    XCTAssertEqual(histogram.maxMicroseconds, 60000000);
+    XCTAssertEqual(histogram.buckets[0], 2);
+    XCTAssertEqual(histogram.buckets[5], 1);
+    XCTAssertEqual(histogram.buckets[MSAL_METRICS_HISTOGRAM_BUCKET_COUNT - 1], 1);
+    XCTAssertEqual([registry snapshot].signInStateReadLatency.count, 0);
+}
+
+- (void)testRecordLatencySinceStartTime_shouldRecordElapsedTime
+{
+    MSALMetricsRegistry *registry = [MSALMetricsRegistry new];
+    uint64_t startTime = [MSALMetricsRegistry currentTime];
+    
+    [NSThread sleepForTimeInterval:0.01];
+    [registry recordLatencySinceStartTime:startTime histogram:MSALMetricsHistogramKeychainWriteLatency];
+    
+    MSALHistogramSnapshot histogram = [registry snapshot].keychainWriteLatency;
+    XCTAssertEqual(histogram.count, 1);
+    XCTAssertGreaterThanOrEqual(histogram.totalMicroseconds, 10000);
+}
+
+- (void)testReset_shouldClearCountersAndHistograms
+{
+    MSALMetricsRegistry *registry = [MSALMetricsRegistry new];
+    [registry incrementCounter:MSALMetricsCounterNativeAuthHttpRetry];
+    [registry recordLatencyMicroseconds:100 histogram:MSALMetricsHistogramSsoExtensionQueryLatency];
+    
+    [registry reset];
+    
+    MSALMetricsSnapshot snapshot = [registry snapshot];
+    XCTAssertEqual(snapshot.nativeAuthHttpRetries, 0);
+    XCTAssertEqual(snapshot.ssoExtensionQueryLatency.count, 0);
+    XCTAssertEqual(snapshot.ssoExtensionQueryLatency.maxMicroseconds, 0);
+    XCTAssertEqual(snapshot.ssoExtensionQueryLatency.buckets[0], 0);
+}
+
+- (void)testRecord_fromConcurrentThreads_shouldNotLoseUpdates
+{
+    MSALMetricsRegistry *registry = [MSALMetricsRegistry new];
+    
+    dispatch_apply(8, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+        for (uint64_t i = 1; i <= 10000; i++)
+        {
+            [registry incrementCounter:MSALMetricsCounterCacheMiss];
+            [registry recordLatencyMicroseconds:i + thread histogram:MSALMetricsHistogramSignInStateReadLatency];
+        }
+    });
+    
+    MSALMetricsSnapshot snapshot = [registry snapshot];
+    XCTAssertEqual(snapshot.cacheMisses, 80000);
+    XCTAssertEqual(snapshot.signInStateReadLatency.count, 80000);
+    XCTAssertEqual(snapshot.signInStateReadLatency.maxMicroseconds, 10007);
+}
+
+- (void)testTelemetryConfigMetricsSnapshot_shouldReturnSharedRegistrySnapshot
+{
+    [MSALGlobalConfig.telemetryConfig resetMetrics];
+    [[MSALMetricsRegistry sharedRegistry] incrementCounter:MSALMetricsCounterNativeAuthHttpRetry];
+    
+    XCTAssertEqual(MSALGlobalConfig.telemetryConfig.metricsSnapshot.nativeAuthHttpRetries, 1);
+    
+    [MSALGlobalConfig.telemetryConfig resetMetrics];
+    XCTAssertEqual(MSALGlobalConfig.telemetryConfig.metricsSnapshot.nativeAuthHttpRetries, 0);
+}
+
+@end
@@ -50,6 +50,7 @@
     XCTAssertNil(config.knownAuthorities);
     XCTAssertNil(config.clientApplicationCapabilities);
     XCTAssertEqualWithAccuracy(config.tokenExpirationBuffer, 300, 1);
+    XCTAssertEqualWithAccuracy(config.maximumTokenStaleness, 240, 1);
     XCTAssertNil(config.sliceConfig.dc);
     XCTAssertNil(config.sliceConfig.slice);
     XCTAssertNil(config.sliceConfig);
@@ -74,6 +75,7 @@
     XCTAssertNil(config.knownAuthorities);
     XCTAssertNil(config.clientApplicationCapabilities);
     XCTAssertEqualWithAccuracy(config.tokenExpirationBuffer, 300, 1);
+    XCTAssertEqualWithAccuracy(config.maximumTokenStaleness, 240, 1);
     XCTAssertNil(config.sliceConfig.dc);
     XCTAssertNil(config.sliceConfig.slice);
     XCTAssertNil(config.sliceConfig);
@@ -101,6 +103,7 @@
     XCTAssertNil(copiedConfig.knownAuthorities);
     XCTAssertNil(copiedConfig.clientApplicationCapabilities);
     XCTAssertEqualWithAccuracy(copiedConfig.tokenExpirationBuffer, 300, 1);
+    XCTAssertEqualWithAccuracy(copiedConfig.maximumTokenStaleness, 240, 1);
     XCTAssertNil(copiedConfig.sliceConfig.dc);
     XCTAssertNil(copiedConfig.sliceConfig.slice);
     XCTAssertNil(copiedConfig.sliceConfig);
@@ -123,6 +126,7 @@
     config.knownAuthorities = @[knownAuthority];
     config.clientApplicationCapabilities = @[@"cp1", @"cp2"];
     config.tokenExpirationBuffer = 333;
+    config.maximumTokenStaleness = 111;
     config.sliceConfig = [[MSALSliceConfig alloc] initWithSlice:@"myslice" dc:@"mydc"];
     config.cacheConfig.keychainSharingGroup = @"my.test.group";
     config.extendedLifetimeEnabled = YES;
@@ -139,6 +143,7 @@
     NSArray *expectedCapabilities = @[@"cp1", @"cp2"];
     XCTAssertEqualObjects(copiedConfig.clientApplicationCapabilities, expectedCapabilities);
     XCTAssertEqualWithAccuracy(copiedConfig.tokenExpirationBuffer, 333, 1);
+    XCTAssertEqualWithAccuracy(copiedConfig.maximumTokenStaleness, 111, 1);
     XCTAssertEqualObjects(copiedConfig.sliceConfig.dc, @"mydc");
     XCTAssertEqualObjects(copiedConfig.sliceConfig.slice, @"myslice");
     XCTAssertNotNil(copiedConfig.sliceConfig);
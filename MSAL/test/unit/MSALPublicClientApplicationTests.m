@@ -26,6 +26,7 @@
 //------------------------------------------------------------------------------
 
 #import "MSALTestCase.h"
+#import "MSALAccountSignInStateCache.h"
 #import "XCTestCase+HelperMethods.h"
 #import "MSALPublicClientApplication+Internal.h"
 #import "MSIDTestSwizzle.h"
@@ -3475,6 +3476,11 @@
     MSIDAccountMetadataState signInState = [self.accountMetadataCache signInStateForHomeAccountId:@"myuid.utid" clientId:UNIT_TEST_CLIENT_ID context:nil error:&error];
     XCTAssertNil(error);
     XCTAssertEqual(signInState, MSIDAccountMetadataStateSignedOut);
+    
+    // In-memory sign-in state used by the silent path should be updated too
+    XCTAssertEqual([[MSALAccountSignInStateCache sharedCache] signInStateForHomeAccountId:@"myuid.utid"
+                                                                                 clientId:UNIT_TEST_CLIENT_ID
+                                                                            keychainGroup:application.configuration.cacheConfig.keychainSharingGroup], MSIDAccountMetadataStateSignedOut);
 }
 
 - (void)testRemoveAccount_whenAccountExists_andIsFociClient_shouldRemoveAccount_andMarkClientNonFoci
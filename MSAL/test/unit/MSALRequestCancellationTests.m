@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <XCTest/XCTest.h>
+#import "MSALRequestCancellation.h"
+#import "MSALSilentTokenParameters.h"
+#import "MSALParameters+Internal.h"
+
+@interface MSALRequestCancellationTests : XCTestCase
+
+@end
+
+@implementation MSALRequestCancellationTests
+
+- (void)testCancel_whenHandlerSet_shouldInvokeHandlerOnce
+{
+    MSALRequestCancellation *cancellation = [MSALRequestCancellation new];
+    __block NSInteger invocations = 0;
+    [cancellation setCancellationHandler:^{
+        invocations++;
+    }];
+    
+    [cancellation cancel];
+    [cancellation cancel];
+    
+    XCTAssertTrue(cancellation.isCancelled);
+    XCTAssertEqual(invocations, 1);
+}
+
+- (void)testSetCancellationHandler_whenAlreadyCancelled_shouldInvokeHandlerImmediately
+{
+    MSALRequestCancellation *cancellation = [MSALRequestCancellation new];
+    [cancellation cancel];
+    
+    __block BOOL invoked = NO;
+    [cancellation setCancellationHandler:^{
+        invoked = YES;
+    }];
+    
+    XCTAssertTrue(invoked);
+}
+
+- (void)testTryMarkCompleted_whenCalledTwice_shouldReturnYESOnlyOnce
+{
+    MSALRequestCancellation *cancellation = [MSALRequestCancellation new];
+    
+    XCTAssertTrue([cancellation tryMarkCompleted]);
+    XCTAssertFalse([cancellation tryMarkCompleted]);
+}
+
+- (void)testCancel_whenAlreadyCompleted_shouldNotInvokeHandler
+{
+    MSALRequestCancellation *cancellation = [MSALRequestCancellation new];
+    __block BOOL invoked = NO;
+    [cancellation setCancellationHandler:^{
+        invoked = YES;
+    }];
+    
+    XCTAssertTrue([cancellation tryMarkCompleted]);
+    [cancellation cancel];
+    
+    XCTAssertFalse(invoked);
+}
+
+- (void)testCopy_whenSilentParametersCopied_shouldKeepPropertiesAndNotShareCancellation
+{
+    MSALSilentTokenParameters *parameters = [[MSALSilentTokenParameters alloc] initWithScopes:@[@"user.read"]];
+    parameters.forceRefresh = YES;
+    parameters.correlationId = [NSUUID UUID];
+    
+    MSALSilentTokenParameters *copy = [parameters copy];
+    copy.cancellation = [MSALRequestCancellation new];
+    
+    XCTAssertNotEqual(copy, parameters);
+    XCTAssertEqualObjects(copy.scopes, parameters.scopes);
+    XCTAssertEqualObjects(copy.correlationId, parameters.correlationId);
+    XCTAssertTrue(copy.forceRefresh);
+    XCTAssertNil(parameters.cancellation);
+}
+
+@end
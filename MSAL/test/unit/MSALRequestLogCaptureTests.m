@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+#import <XCTest/XCTest.h>
+#import "MSALRequestLogCapture.h"
+
+@interface MSALRequestLogCaptureTests : XCTestCase
+
+@end
+
+@implementation MSALRequestLogCaptureTests
+
+- (void)testCapture_whenNoRequestIsCaptured_shouldReturnNO
+{
+    MSALRequestLogCapture *capture = [MSALRequestLogCapture new];
+    
+    XCTAssertFalse([capture captureLogWithLevel:MSALLogLevelVerbose message:@"line" containsPII:NO correlationId:[NSUUID UUID]]);
+    XCTAssertFalse([capture isCapturingCorrelationId:[NSUUID UUID]]);
+    XCTAssertEqual(capture.activeCaptureCount, 0);
+}
+
+- (void)testEndCapture_shouldReturnOnlyLinesOfThatRequestInOrder
+{
+    MSALRequestLogCapture *capture = [MSALRequestLogCapture new];
+    NSUUID *correlationId = [NSUUID UUID];
+    NSUUID *otherCorrelationId = [NSUUID UUID];
+    
+    [capture beginCaptureForCorrelationId:correlationId];
+    
+    XCTAssertTrue([capture isCapturingCorrelationId:correlationId]);
+    XCTAssertFalse([capture isCapturingCorrelationId:otherCorrelationId]);
+    XCTAssertTrue([capture captureLogWithLevel:MSALLogLevelVerbose message:@"first" containsPII:NO correlationId:correlationId]);
+    XCTAssertFalse([capture captureLogWithLevel:MSALLogLevelVerbose message:@"other" containsPII:NO correlationId:otherCorrelationId]);
+    XCTAssertFalse([capture captureLogWithLevel:MSALLogLevelVerbose message:@"Line without correlation id" containsPII:NO correlationId:nil]);
+    XCTAssertTrue([capture captureLogWithLevel:MSALLogLevelInfo message:@"second" containsPII:YES correlationId:correlationId]);
+    
+    NSArray<MSALCapturedLogLine *> *lines = [capture endCaptureForCorrelationId:correlationId];
+    
+    XCTAssertEqual(lines.count, 2);
+    XCTAssertTrue([lines[0].message hasSuffix:@"first"]);
+    XCTAssertEqual(lines[0].level, MSALLogLevelVerbose);
+    XCTAssertFalse(lines[0].containsPII);
+    XCTAssertTrue([lines[1].message hasSuffix:@"second"]);
+    XCTAssertEqual(lines[1].level, MSALLogLevelInfo);
+    XCTAssertTrue(lines[1].containsPII);
+    XCTAssertEqual(capture.activeCaptureCount, 0);
+    XCTAssertNil([capture endCaptureForCorrelationId:correlationId]);
+}
+
+- (void)testCapture_whenMoreLinesThanLimit_shouldKeepMostRecentLines
+{
+    MSALRequestLogCapture *capture = [MSALRequestLogCapture new];
+    capture.maxLinesPerRequest = 3;
+    NSUUID *correlationId = [NSUUID UUID];
+    
+    [capture beginCaptureForCorrelationId:correlationId];
+    
+    for (NSUInteger i = 0; i < 5; i++)
+    {
+        [capture captureLogWithLevel:MSALLogLevelVerbose message:@(i).stringValue containsPII:NO correlationId:correlationId];
+    }
+    
+    NSArray<MSALCapturedLogLine *> *lines = [capture endCaptureForCorrelationId:correlationId];
+    
+    XCTAssertEqual(lines.count, 3);
+    XCTAssertTrue([lines[0].message isEqualToString:@"2"]);
+    XCTAssertTrue([lines[1].message isEqualToString:@"3"]);
+    XCTAssertTrue([lines[2].message isEqualToString:@"4"]);
+}
+
+- (void)testEndCapture_whenNested_shouldReturnLinesAfterLastEnd
+{
+    MSALRequestLogCapture *capture = [MSALRequestLogCapture new];
+    NSUUID *correlationId = [NSUUID UUID];
+    
+    [capture beginCaptureForCorrelationId:correlationId];
+    [capture beginCaptureForCorrelationId:correlationId];
+    [capture captureLogWithLevel:MSALLogLevelVerbose message:@"line" containsPII:NO correlationId:correlationId];
+    
+    XCTAssertNil([capture endCaptureForCorrelationId:correlationId]);
+    XCTAssertEqual([capture endCaptureForCorrelationId:correlationId].count, 1);
+}
+
+- (void)testBeginCapture_whenMaxCapturedRequestsReached_shouldNotCaptureMoreRequests
+{
+    MSALRequestLogCapture *capture = [MSALRequestLogCapture new];
+    capture.maxCapturedRequests = 2;
+    
+    [capture beginCaptureForCorrelationId:[NSUUID UUID]];
+    [capture beginCaptureForCorrelationId:[NSUUID UUID]];
+    
+    NSUUID *correlationId = [NSUUID UUID];
+    [capture beginCaptureForCorrelationId:correlationId];
+    
+    XCTAssertEqual(capture.activeCaptureCount, 2);
+    XCTAssertFalse([capture captureLogWithLevel:MSALLogLevelVerbose message:@"line" containsPII:NO correlationId:correlationId]);
+    
+    [capture discardAllCaptures];
+    XCTAssertEqual(capture.activeCaptureCount, 0);
+}
+
+@end
@@ -39,6 +39,7 @@
 #import "MSIDTelemetryAuthorityValidationEvent.h"
 #import "MSALGlobalConfig.h"
 #import "MSALTelemetryConfig.h"
+#import "MSALTelemetrySampler.h"
 
 @interface MSALTelemetryAggregatedTests : MSALTestCase
 
@@ -108,6 +109,20 @@
     XCTAssertNotNil(eventInfo[@"msal.x_client_ver"]);
 }
 
+- (void)testFlush_whenRequestIsNotSampled_shouldNotSendAggregatedEvent
+{
+    [[MSALTelemetrySampler sharedSampler] markUnsampledRequest:self.requestId apiId:120];
+    
+    MSIDTelemetryHttpEvent *httpEvent = [[MSIDTelemetryHttpEvent alloc] initWithName:@"httpEvent" context:self.context];
+    [[MSIDTelemetry sharedInstance] startEvent:self.requestId eventName:@"httpEvent"];
+    [[MSIDTelemetry sharedInstance] stopEvent:self.requestId event:httpEvent];
+    
+    [[MSIDTelemetry sharedInstance] flush:self.requestId];
+    
+    XCTAssertNil(self.receivedEvent);
+    XCTAssertTrue([[MSALTelemetrySampler sharedSampler] completeUnsampledRequest:self.requestId apiId:nil]);
+}
+
 - (void)testFlush_whenThereAreTwoHttpEvents_shouldSendAggregatedEvent
 {
     // HTTP event #1
@@ -0,0 +1,207 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+
+#import <XCTest/XCTest.h>
+#import "MSALTelemetryEventBuffer.h"
+#import "MSALTelemetryEventsObservingProxy.h"
+
+@interface MSALTelemetryBatchingTests : XCTestCase
+
+@end
+
+@implementation MSALTelemetryBatchingTests
+
+#pragma mark - MSALTelemetryEventBuffer
+
+- (void)testInitWithCapacity_shouldRoundUpToPowerOfTwo
+{
+    XCTAssertEqual([[MSALTelemetryEventBuffer alloc] initWithCapacity:100].capacity, 128);
+    XCTAssertEqual([[MSALTelemetryEventBuffer alloc] initWithCapacity:64].capacity, 64);
+}
+
+- (void)testRemoveEvents_shouldReturnEventsInInsertionOrder
+{
+    MSALTelemetryEventBuffer *buffer = [[MSALTelemetryEventBuffer alloc] initWithCapacity:8];
+    
+    for (NSUInteger i = 0; i < 5; i++)
+    {
+        XCTAssertTrue([buffer addEvent:@{@"index" : @(i).stringValue}]);
+    }
+    
+    XCTAssertEqual(buffer.count, 5);
+    
+    NSArray *firstBatch = [buffer removeEventsWithMaxCount:3];
+    NSArray *secondBatch = [buffer removeEventsWithMaxCount:3];
+    
+    XCTAssertEqualObjects([firstBatch valueForKey:@"index"], (@[@"0", @"1", @"2"]));
+    XCTAssertEqualObjects([secondBatch valueForKey:@"index"], (@[@"3", @"4"]));
+    XCTAssertEqual(buffer.count, 0);
+    XCTAssertEqual([buffer removeEventsWithMaxCount:3].count, 0);
+}
+
+- (void)testAddEvent_whenBufferIsFull_shouldDropAndCountEvent
+{
+    MSALTelemetryEventBuffer *buffer = [[MSALTelemetryEventBuffer alloc] initWithCapacity:4];
+    
+    for (NSUInteger i = 0; i < 4; i++)
+    {
+        XCTAssertTrue([buffer addEvent:@{@"index" : @(i).stringValue}]);
+    }
+    
+    XCTAssertFalse([buffer addEvent:@{@"index" : @"4"}]);
+    XCTAssertFalse([buffer addEvent:@{@"index" : @"5"}]);
+    XCTAssertEqual(buffer.droppedEventCount, 2);
+    
+    [buffer removeEventsWithMaxCount:1];
+    XCTAssertTrue([buffer addEvent:@{@"index" : @"6"}]);
+    XCTAssertEqualObjects([[buffer removeEventsWithMaxCount:10] valueForKey:@"index"], (@[@"1", @"2", @"3", @"6"]));
+}
+
+- (void)testAddEvent_fromConcurrentProducers_shouldNotLoseOrDuplicateEvents
+{
+    MSALTelemetryEventBuffer *buffer = [[MSALTelemetryEventBuffer alloc] initWithCapacity:256];
+    NSUInteger producerCount = 8;
+    NSUInteger eventsPerProducer = 2000;
+    NSMutableSet *received = [NSMutableSet new];
+    __block NSUInteger added = 0;
+    
+    dispatch_group_t group = dispatch_group_create();
+    dispatch_queue_t queue = dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0);
+    
+    for (NSUInteger producer = 0; producer < producerCount; producer++)
+    {
+        dispatch_group_async(group, queue, ^{
+            NSUInteger producerAdded = 0;
+            for (NSUInteger i = 0; i < eventsPerProducer; i++)
+            {
+                if ([buffer addEvent:@{@"id" : [NSString stringWithFormat:@"%lu-%lu", (unsigned long)producer, (unsigned long)i]}]) producerAdded++;
+            }
+            
+            @synchronized (received) { added += producerAdded; }
+        });
+    }
+    
+    while (dispatch_group_wait(group, DISPATCH_TIME_NOW) != 0)
+    {
+        [received addObjectsFromArray:[[buffer removeEventsWithMaxCount:64] valueForKey:@"id"]];
+    }
+    [received addObjectsFromArray:[[buffer removeEventsWithMaxCount:NSUIntegerMax] valueForKey:@"id"]];
+    
+    XCTAssertEqual(received.count, added);
+    XCTAssertEqual(added + buffer.droppedEventCount, producerCount * eventsPerProducer);
+}
+
+#pragma mark - MSALTelemetryEventsObservingProxy
+
+- (void)testOnEventsReceived_whenBatchCallbackSet_shouldDeliverFullBatchesOnBackgroundQueue
+{
+    MSALTelemetryEventsObservingProxy *proxy = [MSALTelemetryEventsObservingProxy new];
+    proxy.batchSize = 3;
+    proxy.batchFlushInterval = 60;
+    
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Batches delivered"];
+    expectation.expectedFulfillmentCount = 2;
+    NSMutableArray *batches = [NSMutableArray new];
+    proxy.batchCallback = ^(NSArray<NSDictionary<NSString *, NSString *> *> *events)
+    {
+        XCTAssertFalse([NSThread isMainThread]);
+        @synchronized (batches) { [batches addObject:events]; }
+        [expectation fulfill];
+    };
+    
+    for (NSUInteger i = 0; i < 6; i++)
+    {
+        [proxy onEventsReceived:@[@{@"index" : @(i).stringValue}]];
+    }
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    XCTAssertEqual(batches.count, 2);
+    XCTAssertEqual([batches.firstObject count], 3);
+    XCTAssertEqual([batches.lastObject count], 3);
+}
+
+- (void)testOnEventsReceived_whenBatchNotFull_shouldDeliverAfterFlushInterval
+{
+    MSALTelemetryEventsObservingProxy *proxy = [MSALTelemetryEventsObservingProxy new];
+    proxy.batchSize = 10;
+    proxy.batchFlushInterval = 0.1;
+    
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Partial batch delivered"];
+    proxy.batchCallback = ^(NSArray<NSDictionary<NSString *, NSString *> *> *events)
+    {
+        XCTAssertEqual(events.count, 2);
+        [expectation fulfill];
+    };
+    
+    [proxy onEventsReceived:@[@{@"index" : @"0"}, @{@"index" : @"1"}]];
+    
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+}
+
+- (void)testOnEventsReceived_shouldKeepCallingPerEventCallbackSynchronously
+{
+    MSALTelemetryEventsObservingProxy *proxy = [MSALTelemetryEventsObservingProxy new];
+    __block NSDictionary *receivedEvent = nil;
+    proxy.telemetryCallback = ^(NSDictionary<NSString *, NSString *> *event)
+    {
+        receivedEvent = event;
+    };
+    proxy.batchCallback = ^(__unused NSArray<NSDictionary<NSString *, NSString *> *> *events) {};
+    
+    [proxy onEventsReceived:@[@{@"index" : @"0"}]];
+    
+    XCTAssertEqualObjects(receivedEvent, @{@"index" : @"0"});
+}
+
+- (void)testOnEventsReceived_whenNoBatchCallback_shouldNotBufferEvents
+{
+    MSALTelemetryEventsObservingProxy *proxy = [[MSALTelemetryEventsObservingProxy alloc] initWithBufferCapacity:2];
+    
+    for (NSUInteger i = 0; i < 5; i++)
+    {
+        [proxy onEventsReceived:@[@{@"index" : @(i).stringValue}]];
+    }
+    
+    XCTAssertEqual(proxy.droppedEventCount, 0);
+}
+
+- (void)testOnEventsReceived_whenBufferIsFull_shouldCountDroppedEvents
+{
+    MSALTelemetryEventsObservingProxy *proxy = [[MSALTelemetryEventsObservingProxy alloc] initWithBufferCapacity:2];
+    proxy.batchSize = 100;
+    proxy.batchFlushInterval = 60;
+    proxy.batchCallback = ^(__unused NSArray<NSDictionary<NSString *, NSString *> *> *events) {};
+    
+    for (NSUInteger i = 0; i < 5; i++)
+    {
+        [proxy onEventsReceived:@[@{@"index" : @(i).stringValue}]];
+    }
+    
+    XCTAssertEqual(proxy.droppedEventCount, 3);
+}
+
+@end
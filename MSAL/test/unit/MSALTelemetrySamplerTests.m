@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//------------------------------------------------------------------------------
+#import <XCTest/XCTest.h>
+#import "MSALTelemetrySampler.h"
+
+@interface MSALTelemetrySamplerTests : XCTestCase
+
+@end
+
+@implementation MSALTelemetrySamplerTests
+
+- (void)testShouldSample_whenDefaultRate_shouldSampleAllRequests
+{
+    MSALTelemetrySampler *sampler = [MSALTelemetrySampler new];
+    
+    for (NSUInteger i = 0; i < 100; i++)
+    {
+        XCTAssertTrue([sampler shouldSampleApiId:80 correlationId:[NSUUID UUID]]);
+    }
+}
+
+- (void)testShouldSample_whenRateIsZero_shouldSkipAllRequests
+{
+    MSALTelemetrySampler *sampler = [MSALTelemetrySampler new];
+    sampler.defaultSamplingRate = 0;
+    
+    for (NSUInteger i = 0; i < 100; i++)
+    {
+        XCTAssertFalse([sampler shouldSampleApiId:80 correlationId:[NSUUID UUID]]);
+    }
+}
+
+- (void)testShouldSample_whenSameCorrelationId_shouldReturnSameDecision
+{
+    MSALTelemetrySampler *sampler = [MSALTelemetrySampler new];
+    sampler.defaultSamplingRate = 0.5;
+    MSALTelemetrySampler *otherSampler = [MSALTelemetrySampler new];
+    otherSampler.defaultSamplingRate = 0.5;
+    
+    for (NSUInteger i = 0; i < 100; i++)
+    {
+        NSUUID *correlationId = [NSUUID UUID];
+        BOOL sampled = [sampler shouldSampleApiId:80 correlationId:correlationId];
+        
+        XCTAssertEqual([sampler shouldSampleApiId:80 correlationId:correlationId], sampled);
+        XCTAssertEqual([otherSampler shouldSampleApiId:80 correlationId:[[NSUUID alloc] initWithUUIDString:correlationId.UUIDString]], sampled);
+    }
+}
+
+- (void)testShouldSample_whenRateIsSet_shouldSampleApproximatelyThatFraction
+{
+    MSALTelemetrySampler *sampler = [MSALTelemetrySampler new];
+    sampler.defaultSamplingRate = 0.1;
+    
+    NSUInteger sampledCount = 0;
+    for (NSUInteger i = 0; i < 20000; i++)
+    {
+        if ([sampler shouldSampleApiId:80 correlationId:[NSUUID UUID]]) sampledCount++;
+    }
+    
+    XCTAssertEqualWithAccuracy(sampledCount / 20000.0, 0.1, 0.02);
+}
+
+- (void)testShouldSample_whenRateIsSetForApiId_shouldOverrideDefaultRate
+{
+    MSALTelemetrySampler *sampler = [MSALTelemetrySampler new];
+    sampler.defaultSamplingRate = 0;
+    [sampler setSamplingRate:1 forApiId:120];
+    
+    XCTAssertEqual([sampler samplingRateForApiId:120], 1);
+    XCTAssertEqual([sampler samplingRateForApiId:80], 0);
+    XCTAssertTrue([sampler shouldSampleApiId:120 correlationId:[NSUUID UUID]]);
+    XCTAssertFalse([sampler shouldSampleApiId:80 correlationId:[NSUUID UUID]]);
+    
+    [sampler removeAllSamplingRates];
+    
+    XCTAssertFalse([sampler shouldSampleApiId:120 correlationId:[NSUUID UUID]]);
+}
+
+- (void)testCompleteUnsampledRequest_shouldReturnApiIdOnce
+{
+    MSALTelemetrySampler *sampler = [MSALTelemetrySampler new];
+    [sampler markUnsampledRequest:@"request-1" apiId:75001];
+    
+    XCTAssertTrue([sampler isUnsampledRequest:@"request-1"]);
+    XCTAssertFalse([sampler isUnsampledRequest:@"request-2"]);
+    
+    NSInteger apiId = 0;
+    XCTAssertTrue([sampler completeUnsampledRequest:@"request-1" apiId:&apiId]);
+    XCTAssertEqual(apiId, 75001);
+    XCTAssertFalse([sampler completeUnsampledRequest:@"request-1" apiId:&apiId]);
+    XCTAssertFalse([sampler isUnsampledRequest:@"request-1"]);
+}
+
+- (void)testMarkUnsampledRequest_whenLimitReached_shouldEvictOnlyOldestRequest
+{
+    MSALTelemetrySampler *sampler = [MSALTelemetrySampler new];
+    
+    for (NSUInteger i = 0; i <= 256; i++)
+    {
+        [sampler markUnsampledRequest:[NSString stringWithFormat:@"request-%lu", (unsigned long)i] apiId:75001];
+    }
+    
+    XCTAssertFalse([sampler isUnsampledRequest:@"request-0"]);
+    XCTAssertTrue([sampler isUnsampledRequest:@"request-1"]);
+    XCTAssertTrue([sampler isUnsampledRequest:@"request-256"]);
+}
+
+@end
@@ -144,6 +144,48 @@ final class MSALNativeAuthCacheAccessorTest: XCTestCase {
         XCTAssertEqual(rawIdToken, newIdToken)
     }
     
+    func testReplaceAccount_whenNoAccountIsStored_shouldSaveTokensAndAccount() {
+        let tokenResponse = getTokenResponse()
+        var rawIdToken: String? = nil
+        var accounts: [MSALAccount] = []
+
+        XCTAssertNoThrow(try cacheAccessor.replaceAccount(tokenResponse: tokenResponse, configuration: parameters.msidConfiguration, context: contextStub))
+        XCTAssertNoThrow(accounts = try cacheAccessor.getAllAccounts(configuration: parameters.msidConfiguration))
+        XCTAssertEqual(accounts.count, 1)
+        XCTAssertEqual(accounts.first?.identifier, parameters.accountIdentifier.homeAccountId)
+        XCTAssertNoThrow(rawIdToken = try cacheAccessor.getIdToken(account: parameters.account, configuration: parameters.msidConfiguration, context: contextStub))
+        XCTAssertEqual(rawIdToken, tokenResponse.idToken)
+    }
+
+    func testReplaceAccount_whenAccountIsStored_shouldKeepOnlyNewTokens() {
+        let tokenResponse = getTokenResponse()
+        XCTAssertNoThrow(try cacheAccessor.validateAndSaveTokensAndAccount(tokenResponse: tokenResponse, configuration: parameters.msidConfiguration, context: contextStub))
+        var rawIdToken: String? = nil
+        var accounts: [MSALAccount] = []
+
+        let newIdToken = "eyJhbGciOiJIUzI1NiJ9.eyJ2ZXIiOiIyLjAiLCJpc3MiOiJodHRwczovL2xvZ2luLm1pY3Jvc29mdG9ubGluZS5jb20vdGVzdC92Mi4wIiwic3ViIjoiQUFBQUFBQUFBQUFBQUFBQUFBQUFBUFdLdXZBcTQ3ZWZsc0o3TXdnaW1rVSIsImF1ZCI6IjA5ODRhN2I2LWJjMTMtNDE0MS04YjBkLThmNzY3ZTEzNmJiNyIsImV4cCI6MTY4MTQ2MzAyMywiaWF0IjoxNjgxMzc2MzIzLCJuYmYiOjE2ODEzNzYzMjMsIm5hbWUiOiJOZXcgVXNlciIsInByZWZlcnJlZF91c2VybmFtZSI6Im5ld0Rpc3BsYXlhYmxlSWQiLCJvaWQiOiJuZXdPaWQiLCJ0aWQiOiJuZXdUaWQiLCJhaW8iOiJEVGhGY3dSdFgwT0tqNXBTSEdOZUdVR1NVNGhaNFJoNU83TmhnUjYzMnpldEM5WmgzM3dWRypXeUJqIVFPM0twU0dXRVRla25sMDA1WE8qQWg0bXhRamVuR2VRZXIqakx3Nypkcmh1cDdTc0NJRThraUlsempYMDZuaWNWNFFFTGZxR3BoYkRuemI0RWtOZEZXTHBOTmhJJCJ9.A9K5OQgR3dUaexxosQg6FOMOteC9R96fI0sZtF-KwjU"
+        tokenResponse.accessToken = "newAccessToken"
+        tokenResponse.refreshToken = "newRefreshToken"
+        tokenResponse.idToken = newIdToken
+        XCTAssertNoThrow(try cacheAccessor.replaceAccount(tokenResponse: tokenResponse, configuration: parameters.msidConfiguration, context: contextStub))
+
+        XCTAssertNoThrow(accounts = try cacheAccessor.getAllAccounts(configuration: parameters.msidConfiguration))
+        XCTAssertEqual(accounts.count, 1)
+        XCTAssertEqual(accounts.first?.username, "newDisplayableId")
+        XCTAssertNoThrow(rawIdToken = try cacheAccessor.getIdToken(account: accounts.first!, configuration: parameters.msidConfiguration, context: contextStub))
+        XCTAssertEqual(rawIdToken, newIdToken)
+    }
+
+    func testReplaceAccount_performance() {
+        let tokenResponse = getTokenResponse()
+
+        measure {
+            for _ in 0..<20 {
+                _ = try? cacheAccessor.replaceAccount(tokenResponse: tokenResponse, configuration: parameters.msidConfiguration, context: contextStub)
+            }
+        }
+    }
+
     func testTokensDeletion_whenAllInfoPresent_shouldRemoveTokensCorrectly() {
         var rawIdToken: String? = nil
         XCTAssertThrowsError(rawIdToken = try cacheAccessor.getIdToken(account: parameters.account, configuration: parameters.msidConfiguration, context: contextStub))
@@ -253,6 +253,34 @@ final class MSALNativeAuthBaseControllerTests: MSALNativeAuthTestCase {
         }
     }
 
+    func test_performRequest_whenDeadlineHasPassed_shouldFailWithoutSending() async {
+        let context = MSALNativeAuthRequestContext(timeoutInterval: 0.01)
+        try? await Task.sleep(nanoseconds: 50_000_000)
+
+        let result: Result<[String], Error> = await sut.performRequest(MSIDHttpRequest(), context: context)
+
+        switch result {
+        case .failure(let error):
+            XCTAssertEqual(error as? MSALNativeAuthInternalError, .deadlineExceeded)
+        case .success:
+            XCTFail("Unexpected response")
+        }
+    }
+
+    func test_performRequest_whenTaskIsCancelled_shouldFailWithoutSending() async {
+        let task = Task { [sut, contextMock] () -> Result<[String], Error> in
+            withUnsafeCurrentTask { $0?.cancel() }
+            return await sut!.performRequest(MSIDHttpRequest(), context: contextMock!)
+        }
+
+        switch await task.value {
+        case .failure(let error):
+            XCTAssertEqual(error as? MSALNativeAuthInternalError, .cancelled)
+        case .success:
+            XCTFail("Unexpected response")
+        }
+    }
+
     func test_performRequest_withUnexpectedError() async {
         let request = MSALNativeAuthHTTPRequestMock.prepareMockRequest(responseJson: [nil])
 
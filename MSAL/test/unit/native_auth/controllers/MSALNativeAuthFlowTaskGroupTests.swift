@@ -0,0 +1,110 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+
+final class MSALNativeAuthFlowTaskGroupTests: XCTestCase {
+
+    private var sut: MSALNativeAuthFlowTaskGroup!
+
+    override func setUp() {
+        super.setUp()
+        sut = MSALNativeAuthFlowTaskGroup()
+    }
+
+    func test_run_executesOperationAndForgetsFinishedTask() async {
+        let exp = expectation(description: "operation executed")
+
+        let task = sut.run {
+            exp.fulfill()
+        }
+
+        await fulfillment(of: [exp], timeout: 1)
+        await task.value
+        XCTAssertEqual(sut.runningTaskCount, 0)
+    }
+
+    func test_cancelAll_cancelsRunningTasks() async {
+        let started = expectation(description: "operation started")
+        let cancelled = expectation(description: "operation cancelled")
+        started.expectedFulfillmentCount = 2
+        cancelled.expectedFulfillmentCount = 2
+
+        for _ in 0..<2 {
+            sut.run {
+                started.fulfill()
+                try? await Task.sleep(nanoseconds: 10_000_000_000)
+                if Task.isCancelled {
+                    cancelled.fulfill()
+                }
+            }
+        }
+
+        await fulfillment(of: [started], timeout: 1)
+        XCTAssertEqual(sut.runningTaskCount, 2)
+
+        sut.cancelAll()
+
+        await fulfillment(of: [cancelled], timeout: 1)
+        XCTAssertEqual(sut.runningTaskCount, 0)
+    }
+
+    func test_deliver_whenTaskWasCancelled_stillCallsCallbacks() async {
+        let started = expectation(description: "operation started")
+        let delivered = expectation(description: "callbacks called")
+
+        sut.run { [sut] in
+            started.fulfill()
+            try? await Task.sleep(nanoseconds: 10_000_000_000)
+            await sut?.deliver {
+                delivered.fulfill()
+            }
+        }
+
+        await fulfillment(of: [started], timeout: 1)
+        sut.cancelAll()
+
+        await fulfillment(of: [delivered], timeout: 1)
+    }
+
+    func test_deliver_callsCallbacksOnMainThread() async {
+        let exp = expectation(description: "callbacks called")
+
+        await sut.deliver {
+            XCTAssertTrue(Thread.isMainThread)
+            exp.fulfill()
+        }
+
+        await fulfillment(of: [exp], timeout: 1)
+    }
+
+    func test_configuration_sharesGroupBetweenCopiesOnly() {
+        let config = MSALNativeAuthConfigStubs.configuration
+        let copy = config
+
+        XCTAssertTrue(config.flowTasks === copy.flowTasks)
+        XCTAssertFalse(config.flowTasks === MSALNativeAuthConfigStubs.configuration.flowTasks)
+    }
+}
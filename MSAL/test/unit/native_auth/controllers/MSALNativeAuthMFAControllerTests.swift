@@ -282,7 +282,7 @@ class MSALNativeAuthMFAControllerTests: MSALNativeAuthSignInControllerTests {
         let result = await sut.submitChallenge(challenge: expectedChallenge, continuationToken: expectedContinuationToken, context: expectedContext, scopes: [], claimsRequestJson: claimsRequestJson)
         result.telemetryUpdate?(.success(()))
 
-        XCTAssertTrue(cacheAccessorMock.clearCacheWasCalled)
+        XCTAssertTrue(cacheAccessorMock.replaceAccountWasCalled)
         XCTAssertTrue(cacheAccessorMock.validateAndSaveTokensWasCalled)
         checkTelemetryEventResult(id: .telemetryApiIdMFASubmitChallenge, isSuccessful: true)
         guard case let .completed(result) = result.result else {
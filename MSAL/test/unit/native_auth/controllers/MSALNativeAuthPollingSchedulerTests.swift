@@ -0,0 +1,172 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+
+final class MSALNativeAuthPollingSchedulerTests: XCTestCase {
+
+    private var now: TimeInterval = 0
+    private var sleeps: [TimeInterval] = []
+
+    override func setUp() {
+        super.setUp()
+        now = 0
+        sleeps = []
+    }
+
+    func test_poll_whenFirstCallCompletes_shouldNotSleep() async {
+        let sut = makeSut()
+
+        let outcome = await sut.poll { .completed("done") }
+
+        XCTAssertEqual(value(of: outcome), "done")
+        XCTAssertTrue(sleeps.isEmpty)
+    }
+
+    func test_poll_shouldProbeFastThenBackOffUpToMaximumDelay() async {
+        let sut = makeSut(firstProbeDelay: 0.5, maximumDelay: 3, timeout: 100)
+        var calls = 0
+
+        let outcome = await sut.poll { () -> MSALNativeAuthPollingScheduler.PollResult<String> in
+            calls += 1
+            return calls == 6 ? .completed("done") : .pending(retryAfter: nil)
+        }
+
+        XCTAssertEqual(value(of: outcome), "done")
+        XCTAssertEqual(sleeps, [0.5, 1, 2, 3, 3])
+    }
+
+    func test_poll_shouldApplyJitterBelowTheDelay() async {
+        let sut = makeSut(firstProbeDelay: 1, maximumDelay: 1, timeout: 100, random: { $0.lowerBound })
+        var calls = 0
+
+        _ = await sut.poll { () -> MSALNativeAuthPollingScheduler.PollResult<String> in
+            calls += 1
+            return calls == 3 ? .completed("done") : .pending(retryAfter: nil)
+        }
+
+        XCTAssertEqual(sleeps, [0.8, 0.8])
+    }
+
+    func test_poll_whenServerSendsRetryAfter_shouldWaitAtLeastThatLong() async {
+        let sut = makeSut(firstProbeDelay: 0.5, maximumDelay: 3, timeout: 100)
+        var calls = 0
+
+        _ = await sut.poll { () -> MSALNativeAuthPollingScheduler.PollResult<String> in
+            calls += 1
+            return calls == 3 ? .completed("done") : .pending(retryAfter: calls == 1 ? 4 : 0.1)
+        }
+
+        XCTAssertEqual(sleeps, [4, 1])
+    }
+
+    func test_poll_whenRetryAfterIsPastTheDeadline_shouldTimeOut() async {
+        let sut = makeSut(firstProbeDelay: 0.5, maximumDelay: 3, timeout: 5)
+
+        let outcome = await sut.poll { () -> MSALNativeAuthPollingScheduler.PollResult<String> in .pending(retryAfter: 10) }
+
+        XCTAssertTrue(isTimedOut(outcome))
+        XCTAssertTrue(sleeps.isEmpty)
+    }
+
+    func test_poll_shouldStopAtTheDeadline() async {
+        let sut = makeSut(firstProbeDelay: 0.5, maximumDelay: 2, timeout: 5)
+        var calls = 0
+
+        let outcome = await sut.poll { () -> MSALNativeAuthPollingScheduler.PollResult<String> in
+            calls += 1
+            return .pending(retryAfter: nil)
+        }
+
+        XCTAssertTrue(isTimedOut(outcome))
+        XCTAssertEqual(sleeps, [0.5, 1, 2, 1.5])
+        XCTAssertEqual(calls, 5)
+    }
+
+    func test_poll_whenTimeoutIsZero_shouldPollOnce() async {
+        let sut = makeSut(firstProbeDelay: 0, maximumDelay: 0, timeout: 0)
+        var calls = 0
+
+        let outcome = await sut.poll { () -> MSALNativeAuthPollingScheduler.PollResult<String> in
+            calls += 1
+            return .pending(retryAfter: nil)
+        }
+
+        XCTAssertTrue(isTimedOut(outcome))
+        XCTAssertEqual(calls, 1)
+    }
+
+    func test_poll_whenTaskIsCancelledDuringSleep_shouldStopImmediately() async {
+        let sut = MSALNativeAuthPollingScheduler(firstProbeDelay: 30, maximumDelay: 30, timeout: 300)
+        // Fulfilling the expectation a second time fails the test, so this also checks that no further poll happens.
+        let firstCall = expectation(description: "first poll")
+
+        let task = Task { () -> MSALNativeAuthPollingScheduler.Outcome<String> in
+            await sut.poll {
+                firstCall.fulfill()
+                return .pending(retryAfter: nil)
+            }
+        }
+
+        await fulfillment(of: [firstCall], timeout: 5)
+        task.cancel()
+        let outcome = await task.value
+
+        guard case .cancelled = outcome else {
+            return XCTFail("Expected polling to be cancelled, got \(outcome)")
+        }
+    }
+
+    // MARK: - Private
+
+    private func makeSut(
+        firstProbeDelay: TimeInterval = 0.5,
+        maximumDelay: TimeInterval = 3,
+        timeout: TimeInterval = 100,
+        random: @escaping (ClosedRange<Double>) -> Double = { $0.upperBound }
+    ) -> MSALNativeAuthPollingScheduler {
+        MSALNativeAuthPollingScheduler(
+            firstProbeDelay: firstProbeDelay,
+            maximumDelay: maximumDelay,
+            timeout: timeout,
+            currentTime: { self.now },
+            sleep: { interval in
+                self.sleeps.append(interval)
+                self.now += interval
+            },
+            random: random
+        )
+    }
+
+    private func value(of outcome: MSALNativeAuthPollingScheduler.Outcome<String>) -> String? {
+        guard case .completed(let value) = outcome else { return nil }
+        return value
+    }
+
+    private func isTimedOut(_ outcome: MSALNativeAuthPollingScheduler.Outcome<String>) -> Bool {
+        guard case .timedOut = outcome else { return false }
+        return true
+    }
+}
@@ -844,6 +844,8 @@ final class MSALNativeAuthResetPasswordControllerTests: MSALNativeAuthTestCase {
     }
 
     func test_whenSubmitPassword_pollCompletion_returns_inProgress_it_returnsErrorAfterRetries() async {
+        sut = makeControllerWithFakeClock()
+
         requestProviderMock.mockSubmitRequestFunc(MSALNativeAuthHTTPRequestMock.prepareMockRequest())
         requestProviderMock.expectedSubmitRequestParameters = expectedSubmitParams()
         validatorMock.mockValidateResetPasswordSubmitFunc(.success(continuationToken: "continuationToken", pollInterval: 0))
@@ -866,6 +868,32 @@ final class MSALNativeAuthResetPasswordControllerTests: MSALNativeAuthTestCase {
         checkTelemetryEventResult(id: .telemetryApiIdResetPasswordSubmit, isSuccessful: false)
     }
 
+    func test_whenSubmitPassword_pollIntervalIsZero_it_keepsPollingBeforeTimingOut() async {
+        let defaultScheduler = MSALNativeAuthResetPasswordController.pollCompletionScheduler(pollInterval: 0)
+        sut = makeControllerWithFakeClock()
+
+        requestProviderMock.mockSubmitRequestFunc(MSALNativeAuthHTTPRequestMock.prepareMockRequest())
+        requestProviderMock.expectedSubmitRequestParameters = expectedSubmitParams()
+        validatorMock.mockValidateResetPasswordSubmitFunc(.success(continuationToken: "continuationToken", pollInterval: 0))
+        requestProviderMock.mockPollCompletionRequestFunc(MSALNativeAuthHTTPRequestMock.prepareMockRequest())
+        requestProviderMock.expectedPollCompletionParameters = expectedPollCompletionParameters()
+        validatorMock.mockValidateResetPasswordPollCompletionFunc(.success(status: .inProgress, continuationToken: "<continuationToken>"))
+
+        prepareMockRequestsForPollCompletionRetries(7)
+
+        let exp = expectation(description: "ResetPasswordController expectation")
+        let helper = prepareResetPasswordSubmitPasswordValidatorHelper(exp)
+
+        let result = await sut.submitPassword(password: "password", username: "", continuationToken: "continuationToken", context: contextMock)
+        helper.onResetPasswordRequiredError(result)
+
+        await fulfillment(of: [exp])
+        XCTAssertGreaterThan(defaultScheduler.timeout, 0)
+        XCTAssertGreaterThanOrEqual(requestProviderMock.pollCompletionCallCount, 5)
+        XCTAssertTrue(helper.onResetPasswordRequiredErrorCalled)
+        XCTAssertEqual(helper.error?.type, .generalError)
+    }
+
     // MARK: - Sign-in with continuationToken
 
     func test_whenResetPasswordSucceeds_and_userCallsSignInWithContinuationToken_ResetPasswordControllerPassesCorrectParams() async {
@@ -1072,6 +1100,27 @@ final class MSALNativeAuthResetPasswordControllerTests: MSALNativeAuthTestCase {
             continuationToken: token)
     }
 
+    /// Polls on a fake clock, so the default polling delays and timeout pass without sleeping.
+    private func makeControllerWithFakeClock() -> MSALNativeAuthResetPasswordController {
+        var now: TimeInterval = 0
+        return .init(config: MSALNativeAuthConfigStubs.configuration,
+                     requestProvider: requestProviderMock,
+                     responseValidator: validatorMock,
+                     signInController: MSALNativeAuthControllerFactoryMock().signInController,
+                     makePollingScheduler: { pollInterval in
+                         let defaultScheduler = MSALNativeAuthResetPasswordController.pollCompletionScheduler(pollInterval: pollInterval)
+                         return MSALNativeAuthPollingScheduler(
+                             firstProbeDelay: defaultScheduler.firstProbeDelay,
+                             maximumDelay: defaultScheduler.maximumDelay,
+                             timeout: defaultScheduler.timeout,
+                             currentTime: { now },
+                             sleep: { now += $0 },
+                             random: { $0.upperBound }
+                         )
+                     }
+        )
+    }
+
     private func prepareMockRequestsForPollCompletionRetries(_ count: Int) {
         for _ in 1...count {
             _ = MSALNativeAuthHTTPRequestMock.prepareMockRequest()
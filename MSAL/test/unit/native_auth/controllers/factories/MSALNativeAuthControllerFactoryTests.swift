@@ -0,0 +1,71 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+
+final class MSALNativeAuthControllerFactoryTests: XCTestCase {
+
+    private var sut: MSALNativeAuthControllerFactory!
+    private var cacheAccessor: MSALNativeAuthCacheAccessorMock!
+
+    override func setUp() {
+        super.setUp()
+        sut = MSALNativeAuthControllerFactory(config: MSALNativeAuthConfigStubs.configuration)
+        cacheAccessor = MSALNativeAuthCacheAccessorMock()
+    }
+
+    func test_whenSameCacheAccessorIsUsed_sameControllersAreReturned() {
+        XCTAssertTrue(sut.makeSignInController(cacheAccessor: cacheAccessor) as AnyObject === sut.makeSignInController(cacheAccessor: cacheAccessor) as AnyObject)
+        XCTAssertTrue(sut.makeSignUpController(cacheAccessor: cacheAccessor) as AnyObject === sut.makeSignUpController(cacheAccessor: cacheAccessor) as AnyObject)
+        XCTAssertTrue(sut.makeJITController(cacheAccessor: cacheAccessor) as AnyObject === sut.makeJITController(cacheAccessor: cacheAccessor) as AnyObject)
+        XCTAssertTrue(sut.makeResetPasswordController(cacheAccessor: cacheAccessor) as AnyObject === sut.makeResetPasswordController(cacheAccessor: cacheAccessor) as AnyObject)
+        XCTAssertTrue(sut.makeCredentialsController(cacheAccessor: cacheAccessor) as AnyObject === sut.makeCredentialsController(cacheAccessor: cacheAccessor) as AnyObject)
+    }
+
+    func test_whenCacheAccessorChanges_newControllerIsReturned() {
+        let first = sut.makeSignInController(cacheAccessor: cacheAccessor)
+        let second = sut.makeSignInController(cacheAccessor: MSALNativeAuthCacheAccessorMock())
+
+        XCTAssertFalse(first as AnyObject === second as AnyObject)
+    }
+
+    func test_whenDifferentFactoriesAreUsed_controllersAreNotShared() {
+        let otherFactory = MSALNativeAuthControllerFactory(config: MSALNativeAuthConfigStubs.configuration)
+
+        XCTAssertFalse(sut.makeSignInController(cacheAccessor: cacheAccessor) as AnyObject === otherFactory.makeSignInController(cacheAccessor: cacheAccessor) as AnyObject)
+    }
+
+    func test_performance_controllersForAllEntryPoints() {
+        measure(metrics: [XCTMemoryMetric(), XCTClockMetric()]) {
+            for _ in 0..<100 {
+                _ = sut.makeSignInController(cacheAccessor: cacheAccessor)
+                _ = sut.makeSignUpController(cacheAccessor: cacheAccessor)
+                _ = sut.makeResetPasswordController(cacheAccessor: cacheAccessor)
+                _ = sut.makeJITController(cacheAccessor: cacheAccessor)
+                _ = sut.makeCredentialsController(cacheAccessor: cacheAccessor)
+            }
+        }
+    }
+}
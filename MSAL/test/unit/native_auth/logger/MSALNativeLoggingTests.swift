@@ -133,6 +133,32 @@ final class MSALNativeLoggingTests: MSALNativeAuthTestCase {
         }
     }
     
+    func testLogWithContext_whenLevelIsFilteredAndRequestIsCaptured_shouldCaptureWithoutChangingLogLevel() throws {
+        MSALGlobalConfig.loggerConfig.logLevel = .error
+        MSALGlobalConfig.loggerConfig.captureLogsForFailedRequests = true
+        defer {
+            MSALGlobalConfig.loggerConfig.captureLogsForFailedRequests = false
+            MSALGlobalConfig.loggerConfig.logLevel = .last
+        }
+
+        let correlationId = try XCTUnwrap(context.correlationId)
+        MSALGlobalConfig.loggerConfig.beginLogCapture(forCorrelationId: correlationId)
+        XCTAssertEqual(MSALGlobalConfig.loggerConfig.logLevel, .error)
+
+        MSALNativeAuthLogger.log(level: .verbose, context: context, format: "Captured %@", "String")
+        MSALNativeAuthLogger.log(level: .verbose, context: MSIDBasicContext(), format: "Not captured")
+        XCTAssertEqual(Self.logger.messages.count, 0)
+
+        Self.logger.expectation = XCTestExpectation(description: "Callback Invoked")
+        MSALGlobalConfig.loggerConfig.endLogCapture(forCorrelationId: correlationId, error: ErrorMock.error)
+        XCTWaiter().wait(for: [Self.logger.expectation], timeout: 1)
+
+        XCTAssertEqual(Self.logger.messages.count, 1)
+        let string = try XCTUnwrap(Self.logger.messages.object(at: 0) as? String)
+        XCTAssertNotNil(string.range(of: String(format: messageRegexFormat, correlationId.uuidString, "Captured String"), options: .regularExpression))
+        XCTAssertEqual(Self.logger.level, .verbose)
+    }
+
     // MARK: Log PII With Context
     
     func testLogPIIWithContext_andMaskAll() throws {
@@ -339,4 +365,45 @@ final class MSALNativeLoggingTests: MSALNativeAuthTestCase {
         }
         XCTAssertTrue(Self.logger.containsPII)
     }
+
+    // MARK: Level gating
+
+    func testLog_whenLevelIsFilteredOut_shouldNotBuildMessage() {
+        MSALGlobalConfig.loggerConfig.logLevel = .error
+        var formatEvaluated = false
+        func makeFormat() -> String {
+            formatEvaluated = true
+            return "Test"
+        }
+
+        MSALNativeAuthLogger.log(level: .verbose, context: context, format: makeFormat())
+        MSALNativeAuthLogger.logPII(level: .info, correlationId: correlationId, format: makeFormat())
+
+        XCTAssertFalse(formatEvaluated)
+        XCTAssertEqual(Self.logger.messages.count, 0)
+
+        Self.logger.expectation = XCTestExpectation(description: "Callback Invoked")
+        MSALNativeAuthLogger.log(level: .error, context: context, format: makeFormat())
+        XCTWaiter().wait(for: [Self.logger.expectation], timeout: 1)
+
+        XCTAssertTrue(formatEvaluated)
+        XCTAssertEqual(Self.logger.messages.count, 1)
+    }
+
+    func testLogPerformance_whenLevelIsError_verboseMessagesShouldBeSkipped() {
+        MSALGlobalConfig.loggerConfig.logLevel = .error
+        let error = NSError(domain: "MSALNativeLoggingTests", code: 1, userInfo: [NSLocalizedDescriptionKey: "Decoding failed"])
+
+        measure {
+            for _ in 0..<100_000 {
+                MSALNativeAuthLogger.logPII(
+                    level: .verbose,
+                    context: context,
+                    format: "ResponseSerializer failed decoding \(MSALLogMask.maskPII(error))"
+                )
+            }
+        }
+
+        XCTAssertEqual(Self.logger.messages.count, 0)
+    }
 }
@@ -52,6 +52,7 @@ class MSALNativeAuthCacheAccessorMock: MSALNativeAuthCacheInterface {
 
     private(set) var validateAndSaveTokensWasCalled = false
     private(set) var clearCacheWasCalled = false
+    private(set) var replaceAccountWasCalled = false
     var expectedMSIDTokenResult: MSIDTokenResult?
     var mockUserAccounts: [MSALAccount]?
     var mockIdToken: String?
@@ -77,6 +78,11 @@ class MSALNativeAuthCacheAccessorMock: MSALNativeAuthCacheInterface {
         return expectedMSIDTokenResult
     }
 
+    func replaceAccount(tokenResponse: MSIDTokenResponse, configuration: MSIDConfiguration, context: MSIDRequestContext) throws -> MSIDTokenResult? {
+        replaceAccountWasCalled = true
+        return try validateAndSaveTokensAndAccount(tokenResponse: tokenResponse, configuration: configuration, context: context)
+    }
+
     func removeTokens(accountIdentifier: MSIDAccountIdentifier, authority: MSIDAuthority, clientId: String, context: MSIDRequestContext) throws {
         throw E.notImplemented
     }
@@ -27,6 +27,8 @@ import XCTest
 
 class MSALNativeAuthJITControllerMock: MSALNativeAuthJITControlling {
 
+    let flowTasks = MSALNativeAuthFlowTaskGroup()
+
     private(set) var continuationToken: String?
     private(set) var authMethod: MSALAuthMethod?
     private(set) var verificationContact: String?
@@ -28,6 +28,8 @@ import XCTest
 
 class MSALNativeAuthResetPasswordControllerMock: MSALNativeAuthResetPasswordControlling {
 
+    let flowTasks = MSALNativeAuthFlowTaskGroup()
+
     var resetPasswordResponse: ResetPasswordStartControllerResponse!
     var resendCodeResponse: ResetPasswordResendCodeControllerResponse!
     var submitCodeResponse: ResetPasswordSubmitCodeControllerResponse!
@@ -26,6 +26,7 @@
 import XCTest
 
 class MSALNativeAuthSignInControllerMock: MSALNativeAuthSignInControlling, MSALNativeAuthMFAControlling {
+    let flowTasks = MSALNativeAuthFlowTaskGroup()
     private(set) var username: String?
     private(set) var grantType: MSALNativeAuthGrantType?
     private(set) var continuationToken: String?
@@ -28,6 +28,8 @@ import XCTest
 
 class MSALNativeAuthSignUpControllerMock: MSALNativeAuthSignUpControlling {
 
+    let flowTasks = MSALNativeAuthFlowTaskGroup()
+
     var startResult: MSALNativeAuthSignUpControlling.SignUpStartControllerResponse!
     var resendCodeResult: SignUpResendCodeControllerResponse!
     var submitCodeResult: MSALNativeAuthSignUpControlling.SignUpSubmitCodeControllerResponse!
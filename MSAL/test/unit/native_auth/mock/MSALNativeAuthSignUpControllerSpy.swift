@@ -27,6 +27,7 @@ import XCTest
 @_implementationOnly import MSAL_Private
 
 class MSALNativeAuthSignUpControllerSpy: MSALNativeAuthSignUpControlling {
+    let flowTasks = MSALNativeAuthFlowTaskGroup()
     private let expectation: XCTestExpectation
     private(set) var context: MSIDRequestContext?
     private(set) var signUpStartPasswordCalled = false
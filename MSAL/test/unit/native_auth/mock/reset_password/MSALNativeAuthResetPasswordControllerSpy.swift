@@ -27,6 +27,7 @@ import XCTest
 @_implementationOnly import MSAL_Private
 
 class MSALNativeAuthResetPasswordControllerSpy: MSALNativeAuthResetPasswordControlling {
+    let flowTasks = MSALNativeAuthFlowTaskGroup()
     private let expectation: XCTestExpectation
     private(set) var context: MSIDRequestContext?
     private(set) var continuationToken: String?
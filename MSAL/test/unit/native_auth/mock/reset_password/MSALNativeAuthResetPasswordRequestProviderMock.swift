@@ -155,6 +155,7 @@ class MSALNativeAuthResetPasswordRequestProviderMock: MSALNativeAuthResetPasswor
     var requestPollCompletion: MSIDHttpRequest?
     var throwErrorPollCompletion = false
     private(set) var pollCompletionCalled = false
+    private(set) var pollCompletionCallCount = 0
     var expectedPollCompletionParameters: MSALNativeAuthResetPasswordPollCompletionRequestParameters!
 
     func mockPollCompletionRequestFunc(_ request: MSIDHttpRequest?, throwError: Bool = false) {
@@ -164,6 +165,7 @@ class MSALNativeAuthResetPasswordRequestProviderMock: MSALNativeAuthResetPasswor
 
     func pollCompletion(parameters: MSAL.MSALNativeAuthResetPasswordPollCompletionRequestParameters) throws -> MSIDHttpRequest {
         pollCompletionCalled = true
+        pollCompletionCallCount += 1
         checkParameters(parameters)
 
         if let request = requestPollCompletion {
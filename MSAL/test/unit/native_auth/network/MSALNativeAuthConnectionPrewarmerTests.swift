@@ -0,0 +1,159 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+@_implementationOnly import MSAL_Unit_Test_Private
+
+final class MSALNativeAuthConnectionPrewarmerTests: XCTestCase {
+
+    private var now: TimeInterval = 1000
+    private var session: URLSession!
+    private let context = MSALNativeAuthRequestContext()
+
+    override func setUp() {
+        super.setUp()
+        PrewarmURLProtocolStub.reset()
+        let configuration = URLSessionConfiguration.ephemeral
+        configuration.protocolClasses = [PrewarmURLProtocolStub.self]
+        session = URLSession(configuration: configuration)
+    }
+
+    override func tearDown() {
+        session.invalidateAndCancel()
+        super.tearDown()
+    }
+
+    func test_prewarm_shouldSendHeadRequestToAuthorityHost() throws {
+        let sut = try makeSut()
+
+        prewarmAndWait(sut)
+
+        let requests = PrewarmURLProtocolStub.requests
+        XCTAssertEqual(requests.count, 1)
+        XCTAssertEqual(requests.first?.httpMethod, "HEAD")
+        XCTAssertEqual(requests.first?.url?.absoluteString, "https://contoso.ciamlogin.com/")
+    }
+
+    func test_prewarm_whenCalledAgainShortlyAfter_shouldNotSendAnotherRequest() throws {
+        let sut = try makeSut()
+
+        prewarmAndWait(sut)
+        now += 10
+        prewarmAndWait(sut)
+
+        XCTAssertEqual(PrewarmURLProtocolStub.requests.count, 1)
+    }
+
+    func test_prewarm_whenCalledAfterMinimumInterval_shouldSendAnotherRequest() throws {
+        let sut = try makeSut()
+
+        prewarmAndWait(sut)
+        now += 60
+        prewarmAndWait(sut)
+
+        XCTAssertEqual(PrewarmURLProtocolStub.requests.count, 2)
+    }
+
+    func test_prewarm_whenInterceptorIsCacheable_shouldPrefetchHeadersForStartEndpoints() throws {
+        let interceptor = CacheableInterceptorSpy()
+        let sut = try makeSut(interceptor: interceptor)
+
+        prewarmAndWait(sut)
+
+        XCTAssertEqual(interceptor.requestedPaths.sorted(), [
+            MSALNativeAuthEndpoint.signInInitiate.rawValue,
+            MSALNativeAuthEndpoint.resetPasswordStart.rawValue,
+            MSALNativeAuthEndpoint.signUpStart.rawValue
+        ].map { "/contoso.onmicrosoft.com" + $0 }.sorted())
+    }
+
+    // MARK: - Private
+
+    private func makeSut(interceptor: MSALNativeAuthRequestInterceptor? = nil) throws -> MSALNativeAuthConnectionPrewarmer {
+        var config = try MSALNativeAuthInternalConfiguration(
+            clientId: DEFAULT_TEST_CLIENT_ID,
+            authority: MSALCIAMAuthority(url: XCTUnwrap(URL(string: "https://contoso.ciamlogin.com/contoso.onmicrosoft.com"))),
+            challengeTypes: [.password],
+            capabilities: nil,
+            redirectUri: nil
+        )
+        config.requestInterceptor = interceptor
+
+        return MSALNativeAuthConnectionPrewarmer(config: config, session: { self.session }, currentTime: { self.now })
+    }
+
+    private func prewarmAndWait(_ sut: MSALNativeAuthConnectionPrewarmer) {
+        let expectation = expectation(description: "prewarm finished")
+        sut.prewarm(context: context) { expectation.fulfill() }
+        wait(for: [expectation], timeout: 5)
+    }
+}
+
+private final class PrewarmURLProtocolStub: URLProtocol {
+    private static let lock = NSLock()
+    private static var recordedRequests: [URLRequest] = []
+
+    static var requests: [URLRequest] {
+        lock.lock()
+        defer { lock.unlock() }
+        return recordedRequests
+    }
+
+    static func reset() {
+        lock.lock()
+        recordedRequests = []
+        lock.unlock()
+    }
+
+    override class func canInit(with request: URLRequest) -> Bool { true }
+
+    override class func canonicalRequest(for request: URLRequest) -> URLRequest { request }
+
+    override func startLoading() {
+        Self.lock.lock()
+        Self.recordedRequests.append(request)
+        Self.lock.unlock()
+
+        if let url = request.url, let response = HTTPURLResponse(url: url, statusCode: 404, httpVersion: "HTTP/1.1", headerFields: nil) {
+            client?.urlProtocol(self, didReceive: response, cacheStoragePolicy: .notAllowed)
+        }
+        client?.urlProtocolDidFinishLoading(self)
+    }
+
+    override func stopLoading() {}
+}
+
+private final class CacheableInterceptorSpy: NSObject, MSALNativeAuthRequestInterceptor {
+    var requestedPaths: [String] = []
+
+    func addAdditionalHeaderFields(_ requestUrl: URL?, completionBlock: @escaping MSALNativeAuthRequestInterceptorAddHeaderCompletionBlock) {
+        completionBlock(nil)
+    }
+
+    func addCacheableHeaderFields(_ requestUrl: URL?, completionBlock: @escaping MSALNativeAuthRequestInterceptorCacheableHeaderCompletionBlock) {
+        requestedPaths.append(requestUrl?.path ?? "")
+        completionBlock(["x-token": "token"], 60)
+    }
+}
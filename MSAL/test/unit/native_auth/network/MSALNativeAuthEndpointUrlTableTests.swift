@@ -0,0 +1,93 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+@_implementationOnly import MSAL_Unit_Test_Private
+
+final class MSALNativeAuthEndpointUrlTableTests: XCTestCase {
+
+    private let authorityUrls = [
+        DEFAULT_TEST_AUTHORITY,
+        "https://contoso.ciamlogin.com/contoso.onmicrosoft.com",
+        "https://contoso.ciamlogin.com/"
+    ]
+
+    private let sliceConfigs: [MSALSliceConfig?] = [
+        nil,
+        MSALSliceConfig(slice: "slice", dc: nil),
+        MSALSliceConfig(slice: nil, dc: "TEST-SLICE-IDENTIFIER"),
+        MSALSliceConfig(slice: "slice", dc: "dc with spaces&symbols")
+    ]
+
+    func test_table_matchesUrlBuiltPerRequest_forEveryEndpointAndSliceConfig() throws {
+        for authorityUrl in authorityUrls {
+            for sliceConfig in sliceConfigs {
+                let config = try makeConfig(authorityUrl: authorityUrl, sliceConfig: sliceConfig)
+                let sut = MSALNativeAuthEndpointUrlTable(config: config)
+
+                for endpoint in MSALNativeAuthEndpoint.allCases {
+                    let expectedUrl = try XCTUnwrap(urlBuiltPerRequest(endpoint: endpoint, config: config))
+                    XCTAssertEqual(try sut.url(for: endpoint), expectedUrl, "\(authorityUrl) \(endpoint) \(String(describing: sliceConfig?.dc))")
+                }
+            }
+        }
+    }
+
+    func test_table_whenSliceConfigHasDataCenter_shouldAddDcQueryItem() throws {
+        let config = try makeConfig(authorityUrl: DEFAULT_TEST_AUTHORITY, sliceConfig: MSALSliceConfig(slice: nil, dc: "TEST-SLICE-IDENTIFIER"))
+        let sut = MSALNativeAuthEndpointUrlTable(config: config)
+
+        XCTAssertEqual(
+            try sut.url(for: .resetpasswordPollCompletion).absoluteString,
+            "https://login.microsoftonline.com/common/resetpassword/v1.0/poll_completion?dc=TEST-SLICE-IDENTIFIER"
+        )
+    }
+
+    // MARK: - Private
+
+    private func makeConfig(authorityUrl: String, sliceConfig: MSALSliceConfig?) throws -> MSALNativeAuthInternalConfiguration {
+        var config = try MSALNativeAuthInternalConfiguration(
+            clientId: DEFAULT_TEST_CLIENT_ID,
+            authority: MSALCIAMAuthority(url: XCTUnwrap(URL(string: authorityUrl))),
+            challengeTypes: [.password],
+            capabilities: nil,
+            redirectUri: nil
+        )
+        config.sliceConfig = sliceConfig
+        return config
+    }
+
+    // How MSALNativeAuthRequestable built the endpoint URL for every request before the table was introduced.
+    private func urlBuiltPerRequest(endpoint: MSALNativeAuthEndpoint, config: MSALNativeAuthInternalConfiguration) -> URL? {
+        var components = URLComponents(url: config.authority.url, resolvingAgainstBaseURL: true)
+        components?.path += endpoint.rawValue
+
+        if let dataCenter = config.sliceConfig?.dc {
+            components?.queryItems = [URLQueryItem(name: "dc", value: dataCenter)]
+        }
+
+        return components?.url
+    }
+}
@@ -0,0 +1,96 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+@_implementationOnly import MSAL_Private
+
+final class MSALNativeAuthFormUrlEncoderTests: XCTestCase {
+
+    private typealias sut = MSALNativeAuthFormUrlEncoder
+
+    private let parameters = [
+        "client_id": "b6b8b5a1-ec9f-4a15-a97d-2c4d3f2f6fa8",
+        "username": "user+alias@contoso.com",
+        "password": "p@ss w0rd&=%",
+        "challenge_type": "oob password redirect",
+        "scope": "openid offline_access https://graph.microsoft.com/mail.read",
+        "continuation_token": "uY29tL2F1dGhlbnRpY2F0aW9uL2xvZ2luL2p3dC8xLjAiLCJ0eXAiOiJKV1QifQ.eyJzdWIiOiIxMjM0NTY3ODkwIiwibmFtZSI6IkpvaG4gRG9lIiwiaWF0IjoxNTE2MjM5MDIyfQ"
+    ]
+
+    func test_encode_shouldWritePairsInKeyOrder() {
+        let body = String(data: sut.encode(["b": "2", "c": "3", "a": "1"]), encoding: .utf8)
+
+        XCTAssertEqual(body, "a=1&b=2&c=3")
+    }
+
+    func test_encode_whenParametersAreEqual_shouldReturnSameBody() {
+        XCTAssertEqual(sut.encode(parameters), sut.encode(parameters.merging([:]) { current, _ in current }))
+    }
+
+    func test_encode_shouldEncodeReservedCharacters() {
+        let body = String(data: sut.encode(["key &=": "a b+c/d?e*f-g.h_i~j%"]), encoding: .utf8)
+
+        XCTAssertEqual(body, "key+%26%3D=a+b%2Bc%2Fd%3Fe*f-g.h_i%7Ej%25")
+    }
+
+    func test_encode_whenEmpty_shouldReturnEmptyData() {
+        XCTAssertEqual(sut.encode([:]), Data())
+    }
+
+    func test_encode_shouldMatchIdentityCoreEncodingForEveryPair() {
+        let body = String(data: sut.encode(parameters), encoding: .utf8) ?? ""
+        let encodedPairs = Set(body.components(separatedBy: "&"))
+
+        let expectedPairs = Set(parameters.map {
+            "\($0.key.msidWWWFormURLEncode() ?? "")=\($0.value.msidWWWFormURLEncode() ?? "")"
+        })
+
+        XCTAssertEqual(encodedPairs, expectedPairs)
+    }
+
+    func test_encode_whenValueIsNotAscii_shouldPercentEncodeUtf8() {
+        let body = String(data: sut.encode(["name": "Zoë 😀"]), encoding: .utf8)
+
+        XCTAssertEqual(body, "name=Zo%C3%AB+%F0%9F%98%80")
+    }
+
+    func test_encode_performance() {
+        measure {
+            for _ in 0..<10_000 {
+                _ = sut.encode(parameters)
+            }
+        }
+    }
+
+    func test_encodeWithIdentityCore_performance() {
+        measure {
+            for _ in 0..<10_000 {
+                _ = parameters.map {
+                    "\($0.key.msidWWWFormURLEncode() ?? "")=\($0.value.msidWWWFormURLEncode() ?? "")"
+                }.joined(separator: "&").data(using: .utf8)
+            }
+        }
+    }
+}
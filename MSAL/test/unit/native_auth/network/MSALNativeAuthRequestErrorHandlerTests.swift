@@ -127,6 +127,120 @@ class MSALNativeAuthResponseErrorHandlerTests: XCTestCase {
         wait(for: [expectation], timeout: 1)
     }
 
+    func test_shouldResendWithRetryPolicy_whenServerIsThrottling() {
+        let expectation = expectation(description: "Handle Error Retry Policy")
+
+        let httpResponse = HTTPURLResponse(
+            url: HttpModuleMockConfigurator.baseUrl,
+            statusCode: 503,
+            httpVersion: nil,
+            headerFields: ["Retry-After": "1"]
+        )
+        let httpRequest = MSIDHttpRequest()
+        HttpModuleMockConfigurator.configure(request: httpRequest, responseJson: ["Test": "Response"])
+
+        var scheduledDelays: [TimeInterval] = []
+        let retriesBefore = MSALMetricsRegistry.shared().snapshot().nativeAuthHttpRetries
+        sut = MSALNativeAuthResponseErrorHandler<MSALNativeAuthSignInInitiateResponseError>(scheduleRetry: { delay, block in
+            scheduledDelays.append(delay)
+            block()
+        })
+        sut.retryPolicy = .replayable
+
+        sut.handleError(
+            error,
+            httpResponse: httpResponse,
+            data: nil,
+            httpRequest: httpRequest,
+            responseSerializer: nil,
+            externalSSOContext: nil,
+            context: context
+        ) { result, error in
+            XCTAssertNil(error)
+            XCTAssertEqual((result as? NSDictionary)?["Test"] as? String, "Response")
+            expectation.fulfill()
+        }
+        wait(for: [expectation], timeout: 1)
+
+        XCTAssertEqual(scheduledDelays.count, 1)
+        XCTAssertGreaterThanOrEqual(scheduledDelays.first ?? 0, 1)
+        XCTAssertEqual(MSALMetricsRegistry.shared().snapshot().nativeAuthHttpRetries, retriesBefore + 1)
+    }
+
+    func test_shouldResendWithRetryPolicy_whenReplayableEndpointReturnsServerError() {
+        let expectation = expectation(description: "Handle Error Server Error Retry")
+
+        let httpResponse = HTTPURLResponse(
+            url: HttpModuleMockConfigurator.baseUrl,
+            statusCode: 500,
+            httpVersion: nil,
+            headerFields: nil
+        )
+        let httpRequest = MSIDHttpRequest()
+        HttpModuleMockConfigurator.configure(request: httpRequest, responseJson: ["Test": "Response"])
+
+        var scheduledDelays: [TimeInterval] = []
+        sut = MSALNativeAuthResponseErrorHandler<MSALNativeAuthSignInInitiateResponseError>(scheduleRetry: { delay, block in
+            scheduledDelays.append(delay)
+            block()
+        })
+        sut.retryPolicy = .policy(for: .signInInitiate)
+
+        sut.handleError(
+            error,
+            httpResponse: httpResponse,
+            data: nil,
+            httpRequest: httpRequest,
+            responseSerializer: nil,
+            externalSSOContext: nil,
+            context: context
+        ) { result, error in
+            XCTAssertNil(error)
+            XCTAssertEqual((result as? NSDictionary)?["Test"] as? String, "Response")
+            expectation.fulfill()
+        }
+        wait(for: [expectation], timeout: 1)
+
+        XCTAssertEqual(scheduledDelays.count, 1)
+    }
+
+    func test_shouldNotResend_whenRetryBudgetIsExhausted() {
+        let expectation = expectation(description: "Handle Error Retry Budget Exhausted")
+
+        let httpResponse = HTTPURLResponse(
+            url: HttpModuleMockConfigurator.baseUrl,
+            statusCode: 500,
+            httpVersion: nil,
+            headerFields: nil
+        )
+        let httpRequest = MSALNativeAuthHTTPRequestMock.prepareMockRequest(response: httpResponse, responseJson: [])
+        httpRequest.retryCounter = 0
+
+        let budget = MSALNativeAuthRetryBudget(capacity: 1, tokensPerRequest: 0, tokensPerSecond: 0)
+        XCTAssertTrue(budget.withdrawRetry())
+
+        sut = MSALNativeAuthResponseErrorHandler<MSALNativeAuthSignInInitiateResponseError>(scheduleRetry: { _, _ in
+            XCTFail("No retry should be scheduled")
+        })
+        sut.retryPolicy = .replayable
+        sut.retryBudget = budget
+
+        sut.handleError(
+            error,
+            httpResponse: httpResponse,
+            data: nil,
+            httpRequest: httpRequest,
+            responseSerializer: nil,
+            externalSSOContext: nil,
+            context: context
+        ) { result, error in
+            XCTAssertEqual((error as? NSError)?.code, MSIDErrorCode.serverUnhandledResponse.rawValue)
+            MSIDTestURLSession.clearResponses()
+            expectation.fulfill()
+        }
+        wait(for: [expectation], timeout: 1)
+    }
+
     func test_shouldCompleteAndResend_whenResponseContainsPkeyHeader() {
         let expectation = expectation(description: "Handle Error Response Pkey Header")
 
@@ -0,0 +1,153 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+
+final class MSALNativeAuthRequestHeaderCacheTests: XCTestCase {
+
+    private let requestUrl = URL(string: "https://contoso.ciamlogin.com/contoso.onmicrosoft.com/oauth2/v2.0/token")
+    private var now: TimeInterval = 1000
+
+    func test_headers_whenInterceptorIsNotCacheable_shouldCallInterceptorForEveryRequest() {
+        let interceptor = InterceptorStub()
+        let sut = MSALNativeAuthRequestHeaderCache(interceptor: interceptor, currentTime: { self.now })
+
+        sut.headers(for: requestUrl) { XCTAssertEqual($0, ["x-header": "1"]) }
+        sut.headers(for: requestUrl) { XCTAssertEqual($0, ["x-header": "2"]) }
+
+        XCTAssertEqual(interceptor.addAdditionalHeaderFieldsCallCount, 2)
+    }
+
+    func test_headers_whenCachedHeadersAreValid_shouldNotCallInterceptor() {
+        let interceptor = CacheableInterceptorStub()
+        let sut = MSALNativeAuthRequestHeaderCache(interceptor: interceptor, currentTime: { self.now })
+
+        var results: [[String: String]?] = []
+        sut.headers(for: requestUrl) { results.append($0) }
+        interceptor.complete(headers: ["x-token": "a"], timeToLive: 100)
+
+        now += 50
+        sut.headers(for: requestUrl) { results.append($0) }
+
+        XCTAssertEqual(interceptor.callCount, 1)
+        XCTAssertEqual(results, [["x-token": "a"], ["x-token": "a"]])
+    }
+
+    func test_headers_whenCloseToExpiry_shouldReturnCachedHeadersAndRefreshInBackground() {
+        let interceptor = CacheableInterceptorStub()
+        let sut = MSALNativeAuthRequestHeaderCache(interceptor: interceptor, currentTime: { self.now })
+
+        sut.headers(for: requestUrl) { _ in }
+        interceptor.complete(headers: ["x-token": "a"], timeToLive: 100)
+
+        now += 90
+        var result: [String: String]?
+        sut.headers(for: requestUrl) { result = $0 }
+        sut.headers(for: requestUrl) { _ in }
+
+        XCTAssertEqual(result, ["x-token": "a"])
+        XCTAssertEqual(interceptor.callCount, 2)
+
+        interceptor.complete(headers: ["x-token": "b"], timeToLive: 100)
+
+        now += 20
+        sut.headers(for: requestUrl) { result = $0 }
+
+        XCTAssertEqual(result, ["x-token": "b"])
+        XCTAssertEqual(interceptor.callCount, 2)
+    }
+
+    func test_headers_whenExpired_shouldWaitForInterceptor() {
+        let interceptor = CacheableInterceptorStub()
+        let sut = MSALNativeAuthRequestHeaderCache(interceptor: interceptor, currentTime: { self.now })
+
+        sut.headers(for: requestUrl) { _ in }
+        interceptor.complete(headers: ["x-token": "a"], timeToLive: 100)
+
+        now += 150
+        var results: [[String: String]?] = []
+        sut.headers(for: requestUrl) { results.append($0) }
+        sut.headers(for: requestUrl) { results.append($0) }
+
+        XCTAssertTrue(results.isEmpty)
+        XCTAssertEqual(interceptor.callCount, 2)
+
+        interceptor.complete(headers: ["x-token": "b"], timeToLive: 100)
+
+        XCTAssertEqual(results, [["x-token": "b"], ["x-token": "b"]])
+    }
+
+    func test_headers_whenTimeToLiveIsZero_shouldNotCache() {
+        let interceptor = CacheableInterceptorStub()
+        let sut = MSALNativeAuthRequestHeaderCache(interceptor: interceptor, currentTime: { self.now })
+
+        sut.headers(for: requestUrl) { _ in }
+        interceptor.complete(headers: ["x-token": "a"], timeToLive: 0)
+        sut.headers(for: requestUrl) { _ in }
+
+        XCTAssertEqual(interceptor.callCount, 2)
+    }
+
+    func test_headers_shouldBeCachedPerUrl() {
+        let interceptor = CacheableInterceptorStub()
+        let sut = MSALNativeAuthRequestHeaderCache(interceptor: interceptor, currentTime: { self.now })
+
+        sut.headers(for: requestUrl) { _ in }
+        interceptor.complete(headers: ["x-token": "a"], timeToLive: 100)
+        sut.headers(for: URL(string: "https://contoso.ciamlogin.com/contoso.onmicrosoft.com/oauth2/v2.0/initiate")) { _ in }
+
+        XCTAssertEqual(interceptor.callCount, 2)
+    }
+}
+
+private final class InterceptorStub: NSObject, MSALNativeAuthRequestInterceptor {
+    var addAdditionalHeaderFieldsCallCount = 0
+
+    func addAdditionalHeaderFields(_ requestUrl: URL?, completionBlock: @escaping MSALNativeAuthRequestInterceptorAddHeaderCompletionBlock) {
+        addAdditionalHeaderFieldsCallCount += 1
+        completionBlock(["x-header": "\(addAdditionalHeaderFieldsCallCount)"])
+    }
+}
+
+private final class CacheableInterceptorStub: NSObject, MSALNativeAuthRequestInterceptor {
+    var callCount = 0
+    private var pendingCompletion: MSALNativeAuthRequestInterceptorCacheableHeaderCompletionBlock?
+
+    func addAdditionalHeaderFields(_ requestUrl: URL?, completionBlock: @escaping MSALNativeAuthRequestInterceptorAddHeaderCompletionBlock) {
+        XCTFail("Cacheable headers should be requested instead")
+        completionBlock(nil)
+    }
+
+    func addCacheableHeaderFields(_ requestUrl: URL?, completionBlock: @escaping MSALNativeAuthRequestInterceptorCacheableHeaderCompletionBlock) {
+        callCount += 1
+        pendingCompletion = completionBlock
+    }
+
+    func complete(headers: [String: String]?, timeToLive: TimeInterval) {
+        let completion = pendingCompletion
+        pendingCompletion = nil
+        completion?(headers, timeToLive)
+    }
+}
@@ -95,6 +95,179 @@ final class MSALNativeAuthResponseSerializerTests: XCTestCase {
 
         XCTAssertEqual(resultCorrelationId?.uuidString, "9958D9BC-D9D1-43E4-B5CA-5A7B0C3F28B0")
     }
+
+    // MARK: - Native auth responses
+
+    private let signInInitiateFixture = """
+    {
+      "continuation_token": "continuation-token",
+      "challenge_type": "redirect",
+      "redirect_reason": "reason"
+    }
+    """
+
+    private let signInIntrospectFixture = """
+    {
+      "continuation_token": "continuation-token",
+      "challenge_type": "oob",
+      "methods": [
+        {
+          "id": "method-id",
+          "challenge_type": "oob",
+          "challenge_channel": "email",
+          "login_hint": "us****@contoso.com"
+        }
+      ]
+    }
+    """
+
+    private let signInChallengeFixture = """
+    {
+      "continuation_token": "continuation-token",
+      "challenge_type": "oob",
+      "binding_method": "prompt",
+      "challenge_target_label": "us****@contoso.com",
+      "challenge_channel": "email",
+      "code_length": 8,
+      "interval": 300
+    }
+    """
+
+    private let signUpStartFixture = """
+    {
+      "continuation_token": "continuation-token",
+      "challenge_type": "oob"
+    }
+    """
+
+    private let signUpChallengeFixture = """
+    {
+      "continuation_token": "continuation-token",
+      "challenge_type": "oob",
+      "binding_method": "prompt",
+      "interval": 300,
+      "challenge_target_label": "us****@contoso.com",
+      "challenge_channel": "email",
+      "code_length": 8
+    }
+    """
+
+    private let signUpContinueFixture = """
+    {
+      "continuation_token": "continuation-token",
+      "expires_in": 600
+    }
+    """
+
+    private let resetPasswordSubmitFixture = """
+    {
+      "continuation_token": "continuation-token",
+      "poll_interval": 2
+    }
+    """
+
+    private let resetPasswordPollCompletionFixture = """
+    {
+      "status": "in_progress",
+      "continuation_token": "continuation-token",
+      "expires_in": 600
+    }
+    """
+
+    func testSerialize_signInResponses_shouldDecodeSnakeCaseKeys() throws {
+        let initiate: MSALNativeAuthSignInInitiateResponse = try decode(signInInitiateFixture)
+        XCTAssertEqual(initiate.continuationToken, "continuation-token")
+        XCTAssertEqual(initiate.challengeType, .redirect)
+        XCTAssertEqual(initiate.redirectReason, "reason")
+
+        let introspect: MSALNativeAuthSignInIntrospectResponse = try decode(signInIntrospectFixture)
+        XCTAssertEqual(introspect.methods?.first?.id, "method-id")
+        XCTAssertEqual(introspect.methods?.first?.challengeType, .oob)
+        XCTAssertEqual(introspect.methods?.first?.challengeChannel, "email")
+        XCTAssertEqual(introspect.methods?.first?.loginHint, "us****@contoso.com")
+
+        let challenge: MSALNativeAuthSignInChallengeResponse = try decode(signInChallengeFixture)
+        XCTAssertEqual(challenge.bindingMethod, "prompt")
+        XCTAssertEqual(challenge.challengeTargetLabel, "us****@contoso.com")
+        XCTAssertEqual(challenge.challengeChannel, "email")
+        XCTAssertEqual(challenge.codeLength, 8)
+        XCTAssertEqual(challenge.interval, 300)
+    }
+
+    func testSerialize_signUpResponses_shouldDecodeSnakeCaseKeys() throws {
+        let start: MSALNativeAuthSignUpStartResponse = try decode(signUpStartFixture)
+        XCTAssertEqual(start.continuationToken, "continuation-token")
+        XCTAssertEqual(start.challengeType, .oob)
+
+        let challenge: MSALNativeAuthSignUpChallengeResponse = try decode(signUpChallengeFixture)
+        XCTAssertEqual(challenge.challengeTargetLabel, "us****@contoso.com")
+        XCTAssertEqual(challenge.codeLength, 8)
+
+        let continueResponse: MSALNativeAuthSignUpContinueResponse = try decode(signUpContinueFixture)
+        XCTAssertEqual(continueResponse.expiresIn, 600)
+    }
+
+    func testSerialize_resetPasswordResponses_shouldDecodeSnakeCaseKeys() throws {
+        let submit: MSALNativeAuthResetPasswordSubmitResponse = try decode(resetPasswordSubmitFixture)
+        XCTAssertEqual(submit.continuationToken, "continuation-token")
+        XCTAssertEqual(submit.pollInterval, 2)
+
+        let pollCompletion: MSALNativeAuthResetPasswordPollCompletionResponse = try decode(resetPasswordPollCompletionFixture)
+        XCTAssertEqual(pollCompletion.status, .inProgress)
+        XCTAssertEqual(pollCompletion.expiresIn, 600)
+    }
+
+    func testSerialize_pollCompletionResponse_shouldReadRetryAfterHeader() throws {
+        let url = try XCTUnwrap(URL(string: "https://contoso.com"))
+        let serializer = MSALNativeAuthResponseSerializer<MSALNativeAuthResetPasswordPollCompletionResponse>()
+
+        let withSeconds = HTTPURLResponse(url: url, statusCode: 200, httpVersion: nil, headerFields: ["Retry-After": "3"])
+        let response = try serializer.responseObject(for: withSeconds, data: resetPasswordPollCompletionFixture.data(using: .utf8), context: nil)
+        XCTAssertEqual((response as? MSALNativeAuthResetPasswordPollCompletionResponse)?.retryAfter, 3)
+
+        let withoutHeader = HTTPURLResponse(url: url, statusCode: 200, httpVersion: nil, headerFields: nil)
+        let responseWithoutHeader = try serializer.responseObject(for: withoutHeader, data: resetPasswordPollCompletionFixture.data(using: .utf8), context: nil)
+        XCTAssertNil((responseWithoutHeader as? MSALNativeAuthResetPasswordPollCompletionResponse)?.retryAfter)
+    }
+
+    func testRetryAfterParser_shouldReadSecondsAndHttpDates() {
+        let now = Date(timeIntervalSince1970: 1_445_412_480) // Wed, 21 Oct 2015 07:28:00 GMT
+
+        XCTAssertEqual(MSALNativeAuthRetryAfterParser.seconds(from: "120", now: now), 120)
+        XCTAssertEqual(MSALNativeAuthRetryAfterParser.seconds(from: "Wed, 21 Oct 2015 07:28:30 GMT", now: now), 30)
+        XCTAssertEqual(MSALNativeAuthRetryAfterParser.seconds(from: "Wed, 21 Oct 2015 07:27:00 GMT", now: now), 0)
+        XCTAssertNil(MSALNativeAuthRetryAfterParser.seconds(from: "-1", now: now))
+        XCTAssertNil(MSALNativeAuthRetryAfterParser.seconds(from: "soon", now: now))
+        XCTAssertNil(MSALNativeAuthRetryAfterParser.seconds(from: nil, now: now))
+    }
+
+    func testSerialize_performance() {
+        let signInInitiate = signInInitiateFixture.data(using: .utf8)
+        let signInIntrospect = signInIntrospectFixture.data(using: .utf8)
+        let signInChallenge = signInChallengeFixture.data(using: .utf8)
+        let signUpStart = signUpStartFixture.data(using: .utf8)
+        let signUpChallenge = signUpChallengeFixture.data(using: .utf8)
+        let resetPasswordSubmit = resetPasswordSubmitFixture.data(using: .utf8)
+        let resetPasswordPollCompletion = resetPasswordPollCompletionFixture.data(using: .utf8)
+
+        measure {
+            for _ in 0..<1_000 {
+                _ = try? MSALNativeAuthResponseSerializer<MSALNativeAuthSignInInitiateResponse>().responseObject(for: nil, data: signInInitiate, context: nil)
+                _ = try? MSALNativeAuthResponseSerializer<MSALNativeAuthSignInIntrospectResponse>().responseObject(for: nil, data: signInIntrospect, context: nil)
+                _ = try? MSALNativeAuthResponseSerializer<MSALNativeAuthSignInChallengeResponse>().responseObject(for: nil, data: signInChallenge, context: nil)
+                _ = try? MSALNativeAuthResponseSerializer<MSALNativeAuthSignUpStartResponse>().responseObject(for: nil, data: signUpStart, context: nil)
+                _ = try? MSALNativeAuthResponseSerializer<MSALNativeAuthSignUpChallengeResponse>().responseObject(for: nil, data: signUpChallenge, context: nil)
+                _ = try? MSALNativeAuthResponseSerializer<MSALNativeAuthResetPasswordSubmitResponse>().responseObject(for: nil, data: resetPasswordSubmit, context: nil)
+                _ = try? MSALNativeAuthResponseSerializer<MSALNativeAuthResetPasswordPollCompletionResponse>().responseObject(for: nil, data: resetPasswordPollCompletion, context: nil)
+            }
+        }
+    }
+
+    private func decode<T: Decodable & MSALNativeAuthResponseCorrelatable>(_ fixture: String) throws -> T {
+        let serializer = MSALNativeAuthResponseSerializer<T>()
+        let response = try serializer.responseObject(for: nil, data: fixture.data(using: .utf8), context: nil)
+        return try XCTUnwrap(response as? T)
+    }
 }
 
 private struct ResponseStub: Decodable, MSALNativeAuthResponseCorrelatable {
@@ -106,4 +279,15 @@ private struct ResponseStub: Decodable, MSALNativeAuthResponseCorrelatable {
     let refreshToken: String
     let idToken: String
     var correlationId: UUID?
+
+    enum CodingKeys: String, CodingKey {
+        case tokenType = "token_type"
+        case scope
+        case expiresIn = "expires_in"
+        case extendedExpiresIn = "extended_expires_in"
+        case accessToken = "access_token"
+        case refreshToken = "refresh_token"
+        case idToken = "id_token"
+        case correlationId = "correlation_id"
+    }
 }
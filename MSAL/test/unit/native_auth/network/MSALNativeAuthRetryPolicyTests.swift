@@ -0,0 +1,182 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+
+final class MSALNativeAuthRetryPolicyTests: XCTestCase {
+
+    private let noJitter: (ClosedRange<Double>) -> Double = { $0.upperBound }
+
+    func test_policy_shouldNotReplayEndpointsThatConsumeCredentials() {
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .token), .throttlingOnly)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .signUpContinue), .throttlingOnly)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .resetPasswordSubmit), .throttlingOnly)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .signInInitiate), .replayable)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .resetPasswordStart), .replayable)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .resetpasswordPollCompletion), .none)
+    }
+
+    func test_policy_shouldNotReplayChallengeEndpoints() {
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .signUpChallenge), .throttlingOnly)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .signInChallenge), .throttlingOnly)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .jitChallenge), .throttlingOnly)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .resetPasswordChallenge), .throttlingOnly)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .resetPasswordComplete), .throttlingOnly)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .signInIntrospect), .replayable)
+        XCTAssertEqual(MSALNativeAuthRetryPolicy.policy(for: .jitIntrospect), .replayable)
+    }
+
+    func test_decision_whenThrottled_shouldRetryOnEveryPolicyThatRetries() {
+        for statusCode in [429, 503] {
+            XCTAssertEqual(decision(.replayable, statusCode: statusCode), .retry(after: 0.5))
+            XCTAssertEqual(decision(.throttlingOnly, statusCode: statusCode), .retry(after: 0.5))
+            XCTAssertEqual(decision(.none, statusCode: statusCode), .doNotRetry)
+        }
+    }
+
+    func test_decision_whenServerError_shouldRetryOnlyReplayableEndpoints() {
+        for statusCode in [500, 502, 504] {
+            XCTAssertEqual(decision(.replayable, statusCode: statusCode), .retry(after: 0.5))
+            XCTAssertEqual(decision(.throttlingOnly, statusCode: statusCode), .doNotRetry)
+        }
+    }
+
+    func test_decision_whenClientError_shouldNotRetry() {
+        for statusCode in [400, 401, 403, 404] {
+            XCTAssertEqual(decision(.replayable, statusCode: statusCode), .doNotRetry)
+        }
+    }
+
+    func test_decision_shouldBackOffExponentiallyUpToMaxDelay() {
+        let policy = MSALNativeAuthRetryPolicy(
+            maxRetries: 5,
+            baseDelay: 0.5,
+            maxDelay: 3,
+            maxRetryAfter: 10,
+            jitterFraction: 0.5,
+            retriesAmbiguousFailures: true
+        )
+
+        let delays = (0..<5).map { decision(policy, statusCode: 503, retriesDone: $0) }
+
+        XCTAssertEqual(delays, [.retry(after: 0.5), .retry(after: 1), .retry(after: 2), .retry(after: 3), .retry(after: 3)])
+    }
+
+    func test_decision_shouldApplyJitterBelowTheBackoffDelay() {
+        let result = MSALNativeAuthRetryPolicy.replayable.decision(
+            statusCode: 503,
+            error: nil,
+            retryAfter: nil,
+            retriesDone: 1,
+            random: { $0.lowerBound }
+        )
+
+        XCTAssertEqual(result, .retry(after: 0.5))
+    }
+
+    func test_decision_whenRetriesAreUsedUp_shouldNotRetry() {
+        XCTAssertEqual(decision(.replayable, statusCode: 503, retriesDone: 2), .doNotRetry)
+    }
+
+    func test_decision_shouldHonorRetryAfter() {
+        XCTAssertEqual(decision(.replayable, statusCode: 429, retryAfter: 3), .retry(after: 3))
+        XCTAssertEqual(decision(.replayable, statusCode: 503, retryAfter: 0.1), .retry(after: 0.5))
+    }
+
+    func test_decision_whenRetryAfterIsTooLong_shouldNotRetry() {
+        XCTAssertEqual(decision(.replayable, statusCode: 429, retryAfter: 60), .doNotRetry)
+    }
+
+    func test_decision_whenServerCouldNotBeReached_shouldRetryOnEveryPolicyThatRetries() {
+        let error = NSError(domain: NSURLErrorDomain, code: NSURLErrorCannotConnectToHost)
+
+        XCTAssertEqual(decision(.replayable, error: error), .retry(after: 0.5))
+        XCTAssertEqual(decision(.throttlingOnly, error: error), .retry(after: 0.5))
+    }
+
+    func test_decision_whenRequestTimedOut_shouldRetryOnlyReplayableEndpoints() {
+        let error = NSError(domain: NSURLErrorDomain, code: NSURLErrorTimedOut)
+
+        XCTAssertEqual(decision(.replayable, error: error), .retry(after: 0.5))
+        XCTAssertEqual(decision(.throttlingOnly, error: error), .doNotRetry)
+    }
+
+    func test_decision_whenErrorIsNotANetworkError_shouldNotRetry() {
+        let error = NSError(domain: "Test Error Domain", code: NSURLErrorTimedOut)
+
+        XCTAssertEqual(decision(.replayable, error: error), .doNotRetry)
+    }
+
+    // MARK: - Retry budget
+
+    func test_budget_shouldAllowRetriesUpToCapacity() {
+        let sut = MSALNativeAuthRetryBudget(capacity: 3, tokensPerRequest: 0.2, tokensPerSecond: 0, currentTime: { 0 })
+
+        XCTAssertTrue(sut.withdrawRetry())
+        XCTAssertTrue(sut.withdrawRetry())
+        XCTAssertTrue(sut.withdrawRetry())
+        XCTAssertFalse(sut.withdrawRetry())
+    }
+
+    func test_budget_shouldRefillWithRequests() {
+        let sut = MSALNativeAuthRetryBudget(capacity: 1, tokensPerRequest: 0.25, tokensPerSecond: 0, currentTime: { 0 })
+        XCTAssertTrue(sut.withdrawRetry())
+
+        for _ in 0..<3 {
+            sut.recordRequest()
+        }
+        XCTAssertFalse(sut.withdrawRetry())
+
+        sut.recordRequest()
+        XCTAssertTrue(sut.withdrawRetry())
+    }
+
+    func test_budget_shouldRefillOverTime() {
+        var now: TimeInterval = 0
+        let sut = MSALNativeAuthRetryBudget(capacity: 1, tokensPerRequest: 0, tokensPerSecond: 0.5, currentTime: { now })
+        XCTAssertTrue(sut.withdrawRetry())
+        XCTAssertFalse(sut.withdrawRetry())
+
+        now = 2
+        XCTAssertTrue(sut.withdrawRetry())
+    }
+
+    func test_budget_shouldBeSharedPerHost() {
+        XCTAssertTrue(MSALNativeAuthRetryBudget.shared(forHost: "contoso.ciamlogin.com") === MSALNativeAuthRetryBudget.shared(forHost: "CONTOSO.ciamlogin.com"))
+        XCTAssertFalse(MSALNativeAuthRetryBudget.shared(forHost: "contoso.ciamlogin.com") === MSALNativeAuthRetryBudget.shared(forHost: "fabrikam.ciamlogin.com"))
+    }
+
+    // MARK: - Private
+
+    private func decision(
+        _ policy: MSALNativeAuthRetryPolicy,
+        statusCode: Int? = nil,
+        error: Error? = nil,
+        retryAfter: TimeInterval? = nil,
+        retriesDone: Int = 0
+    ) -> MSALNativeAuthRetryPolicy.Decision {
+        policy.decision(statusCode: statusCode, error: error, retryAfter: retryAfter, retriesDone: retriesDone, random: noJitter)
+    }
+}
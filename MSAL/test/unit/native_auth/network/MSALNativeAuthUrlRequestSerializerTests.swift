@@ -71,6 +71,25 @@ final class MSALNativeAuthUrlRequestSerializerTests: MSALNativeAuthTestCase {
         XCTAssertEqual(httpHeadersResult["custom-header"], "value")
     }
 
+    func test_serialize_whenContextHasDeadline_shouldShrinkTimeoutToRemainingTime() {
+        request.timeoutInterval = 60
+        sut = MSALNativeAuthUrlRequestSerializer(context: MSALNativeAuthRequestContext(timeoutInterval: 5), encoding: .wwwFormUrlEncoded)
+
+        let result = sut.serialize(with: request, parameters: [:], headers: [:])
+
+        XCTAssertLessThanOrEqual(result.timeoutInterval, 5)
+        XCTAssertGreaterThan(result.timeoutInterval, 0)
+    }
+
+    func test_serialize_whenContextHasNoDeadline_shouldKeepTimeout() {
+        request.timeoutInterval = 60
+        sut = MSALNativeAuthUrlRequestSerializer(context: MSALNativeAuthRequestContext(), encoding: .wwwFormUrlEncoded)
+
+        let result = sut.serialize(with: request, parameters: [:], headers: [:])
+
+        XCTAssertEqual(result.timeoutInterval, 60)
+    }
+
     func test_serialize_with_dict_in_body() throws {
         let customAttributes: [String: Codable] = [
             "name": "John",
@@ -52,4 +52,28 @@ final class MSALNativeAuthRequestContextTests: XCTestCase {
         sut.setServerCorrelationId(serverCorrelationId2)
         XCTAssertEqual(sut.correlationId(), requestCorrelationId)
     }
+
+    func test_remainingTime_whenNoTimeoutInterval_shouldHaveNoDeadline() {
+        let sut = MSALNativeAuthRequestContext()
+
+        XCTAssertNil(sut.remainingTime())
+        XCTAssertFalse(sut.isDeadlineExceeded())
+    }
+
+    func test_remainingTime_shouldCountDownFromTimeoutInterval() throws {
+        let sut = MSALNativeAuthRequestContext(timeoutInterval: 60)
+
+        let remainingTime = try XCTUnwrap(sut.remainingTime())
+        XCTAssertLessThanOrEqual(remainingTime, 60)
+        XCTAssertGreaterThan(remainingTime, 50)
+        XCTAssertFalse(sut.isDeadlineExceeded())
+    }
+
+    func test_isDeadlineExceeded_whenTimeoutIntervalHasPassed_shouldReturnTrue() {
+        let sut = MSALNativeAuthRequestContext(timeoutInterval: 0.01)
+
+        Thread.sleep(forTimeInterval: 0.05)
+
+        XCTAssertTrue(sut.isDeadlineExceeded())
+    }
 }
@@ -0,0 +1,137 @@
+//
+// Copyright (c) Microsoft Corporation.
+// All rights reserved.
+//
+// This code is licensed under the MIT License.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+import XCTest
+@testable import MSAL
+
+final class MSALNativeAuthSilentTokenProviderCacheTests: XCTestCase {
+
+    private var sut: MSALNativeAuthSilentTokenProviderCache!
+    private var buildCount = 0
+
+    override func setUp() {
+        super.setUp()
+        sut = MSALNativeAuthSilentTokenProviderCache(maxEntries: 2)
+        buildCount = 0
+    }
+
+    func test_whenSameConfigurationIsUsed_providerIsBuiltOnce() throws {
+        let configuration = try makeConfiguration()
+
+        let first = sut.provider(for: configuration, makeProvider: makeProvider)
+        let second = sut.provider(for: try makeConfiguration(), makeProvider: makeProvider)
+
+        XCTAssertEqual(buildCount, 1)
+        XCTAssertTrue((first as? MSALNativeAuthSilentTokenProviderMock) === (second as? MSALNativeAuthSilentTokenProviderMock))
+    }
+
+    func test_whenSliceConfigDiffers_newProviderIsBuilt() throws {
+        let configuration = try makeConfiguration()
+        let slicedConfiguration = try makeConfiguration()
+        slicedConfiguration.sliceConfig = MSALSliceConfig(slice: "slice", dc: "dc")
+
+        let first = sut.provider(for: configuration, makeProvider: makeProvider)
+        let second = sut.provider(for: slicedConfiguration, makeProvider: makeProvider)
+
+        XCTAssertEqual(buildCount, 2)
+        XCTAssertFalse((first as? MSALNativeAuthSilentTokenProviderMock) === (second as? MSALNativeAuthSilentTokenProviderMock))
+    }
+
+    func test_whenChallengeTypesDiffer_newProviderIsBuilt() throws {
+        _ = sut.provider(for: try makeConfiguration(challengeTypes: [.OOB]), makeProvider: makeProvider)
+        _ = sut.provider(for: try makeConfiguration(challengeTypes: [.OOB, .password]), makeProvider: makeProvider)
+
+        XCTAssertEqual(buildCount, 2)
+    }
+
+    func test_whenProviderFailsToBuild_itIsNotCached() throws {
+        let configuration = try makeConfiguration()
+
+        XCTAssertNil(sut.provider(for: configuration) { nil })
+        XCTAssertNotNil(sut.provider(for: configuration, makeProvider: makeProvider))
+        XCTAssertEqual(buildCount, 1)
+    }
+
+    func test_whenMaxEntriesIsReached_oldestProviderIsEvicted() throws {
+        let first = try makeConfiguration(clientId: "client1")
+        let second = try makeConfiguration(clientId: "client2")
+        let third = try makeConfiguration(clientId: "client3")
+
+        _ = sut.provider(for: first, makeProvider: makeProvider)
+        _ = sut.provider(for: second, makeProvider: makeProvider)
+        _ = sut.provider(for: third, makeProvider: makeProvider)
+        _ = sut.provider(for: second, makeProvider: makeProvider)
+        XCTAssertEqual(buildCount, 3)
+
+        _ = sut.provider(for: first, makeProvider: makeProvider)
+        XCTAssertEqual(buildCount, 4)
+    }
+
+    func test_removeAll_clearsCachedProviders() throws {
+        let configuration = try makeConfiguration()
+
+        _ = sut.provider(for: configuration, makeProvider: makeProvider)
+        sut.removeAll()
+        _ = sut.provider(for: configuration, makeProvider: makeProvider)
+
+        XCTAssertEqual(buildCount, 2)
+    }
+
+    func test_factory_reusesProviderFromCache() throws {
+        let factory = MSALNativeAuthSilentTokenProviderFactory(cache: sut)
+        let configuration = try makeConfiguration()
+        let cachedProvider = MSALNativeAuthSilentTokenProviderMock()
+        _ = sut.provider(for: configuration) { cachedProvider }
+
+        let provider = try factory.makeSilentTokenProvider(configuration: configuration)
+
+        XCTAssertTrue((provider as? MSALNativeAuthSilentTokenProviderMock) === cachedProvider)
+    }
+
+    func test_performance_repeatedProviderLookups() throws {
+        let configuration = try makeConfiguration()
+
+        measure {
+            for _ in 0..<1000 {
+                _ = sut.provider(for: configuration, makeProvider: makeProvider)
+            }
+        }
+
+        XCTAssertEqual(buildCount, 1)
+    }
+
+    // MARK: - Helpers
+
+    private func makeProvider() -> MSALNativeAuthSilentTokenProviding? {
+        buildCount += 1
+        return MSALNativeAuthSilentTokenProviderMock()
+    }
+
+    private func makeConfiguration(
+        clientId: String = "clientId",
+        challengeTypes: MSALNativeAuthChallengeTypes = [.OOB]
+    ) throws -> MSALNativeAuthPublicClientApplicationConfig {
+        try MSALNativeAuthPublicClientApplicationConfig(clientId: clientId, tenantSubdomain: "tenant", challengeTypes: challengeTypes)
+    }
+}
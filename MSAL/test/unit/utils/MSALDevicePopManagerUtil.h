@@ -28,11 +28,15 @@
 #import "MSIDDevicePopManager.h"
 #import "MSIDAssymetricKeyKeychainGenerator.h"
 
+@class MSALDevicePopManager;
+
 
 @interface MSALDevicePopManagerUtil : NSObject
 
 + (MSIDDevicePopManager *)test_initWithValidCacheConfig;
 
++ (MSALDevicePopManager *)test_initCachingPopManagerWithValidCacheConfig;
+
 + (MSIDAssymetricKeyKeychainGenerator *)keyGeneratorWithConfig:(MSIDCacheConfig *)cacheConfig;
 
 @end
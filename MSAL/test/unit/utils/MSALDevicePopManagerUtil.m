@@ -42,9 +42,20 @@
 #import "MSIDMacKeychainTokenCache.h"
 #import "MSALCacheConfig.h"
 #import "MSIDMacACLKeychainAccessor.h"
+#import "MSALDevicePopManager.h"
 @implementation MSALDevicePopManagerUtil
 
 + (MSIDDevicePopManager *)test_initWithValidCacheConfig
+{
+    return [self test_initPopManagerOfClass:MSIDDevicePopManager.class];
+}
+
++ (MSALDevicePopManager *)test_initCachingPopManagerWithValidCacheConfig
+{
+    return (MSALDevicePopManager *)[self test_initPopManagerOfClass:MSALDevicePopManager.class];
+}
+
++ (MSIDDevicePopManager *)test_initPopManagerOfClass:(Class)managerClass
 {
     MSIDDevicePopManager *manager;
     MSIDCacheConfig *msidCacheConfig;
@@ -63,7 +74,7 @@
     keyPairAttributes.privateKeyIdentifier = MSID_POP_TOKEN_PRIVATE_KEY;
     keyPairAttributes.keyDisplayableLabel = MSID_POP_TOKEN_KEY_LABEL;
     
-    manager = [[MSIDDevicePopManager alloc] initWithCacheConfig:msidCacheConfig keyPairAttributes:keyPairAttributes];
+    manager = [[managerClass alloc] initWithCacheConfig:msidCacheConfig keyPairAttributes:keyPairAttributes];
     [manager setValue:[MSALDevicePopManagerUtil keyGeneratorWithConfig:msidCacheConfig] forKey:@"keyGeneratorFactory"];
     return manager;
 }
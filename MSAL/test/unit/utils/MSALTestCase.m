@@ -41,6 +41,7 @@
 
 #import "MSIDAuthority.h"
 #import "MSIDAadAuthorityCache.h"
+#import "MSALAccountSignInStateCache.h"
 
 @implementation MSALTestCase
 
@@ -60,6 +61,7 @@
     
     [MSIDAuthority.openIdConfigurationCache removeAllObjects];
     [[MSIDAadAuthorityCache sharedInstance] removeAllObjects];
+    [[MSALAccountSignInStateCache sharedCache] removeAllStates];
 }
 
 - (void)tearDown